@@ -0,0 +1,67 @@
+#ifndef BENCH_COMMON_HPP_
+#define BENCH_COMMON_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "StaticVector.hpp"
+
+namespace bench {
+
+// -------------------------------------------------------------------------------------------------
+struct Pod64 {
+  std::array<std::uint64_t, 8> payload;
+
+  constexpr auto operator==(const Pod64&) const noexcept -> bool = default;
+  constexpr auto operator<=>(const Pod64&) const noexcept        = default;
+};
+static_assert(sizeof(Pod64) == 64UZ);
+static_assert(std::is_trivially_copyable_v<Pod64>);
+
+// -------------------------------------------------------------------------------------------------
+// Deterministic element for index `i`. Strings are long enough to not fit into the small string
+// buffer.
+template <typename Element>
+[[nodiscard]] auto make_element(size_t i) -> Element {
+  if constexpr (std::is_same_v<Element, std::string>) {
+    return "A string that does not fit into the small string buffer: " + std::to_string(i);
+  } else if constexpr (std::is_same_v<Element, Pod64>) {
+    Pod64 res{};
+    res.payload.fill(i);
+    return res;
+  } else {
+    return static_cast<Element>(i);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Cheap value of an element that the benchmark loops can accumulate.
+template <typename Element>
+[[nodiscard]] constexpr auto weight(const Element& e) noexcept -> std::uint64_t {
+  if constexpr (std::is_same_v<Element, std::string>) {
+    return e.size();
+  } else if constexpr (std::is_same_v<Element, Pod64>) {
+    return e.payload[0];
+  } else {
+    return static_cast<std::uint64_t>(e);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+template <typename Vec>
+[[nodiscard]] auto make_vector(size_t size) -> Vec {
+  Vec vec;
+  if constexpr (requires { vec.reserve(size); }) {
+    vec.reserve(size);
+  }
+  for (size_t i = 0; i < size; ++i) {
+    vec.push_back(make_element<typename Vec::value_type>(i));
+  }
+  return vec;
+}
+
+}  // namespace bench
+
+#endif  // BENCH_COMMON_HPP_
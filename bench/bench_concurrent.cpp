@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <barrier>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "ConcurrentStaticVector.hpp"
+#include "StaticVector.hpp"
+
+// Worker threads emit a few results each into one shared output buffer, which is drained once all
+// of them are done: a StaticVector behind a mutex against the lock-free ConcurrentStaticVector.
+// Both pay the same barrier per batch.
+
+namespace {
+
+constexpr size_t MAX_THREADS       = 8UZ;
+constexpr size_t RESULTS_PER_BATCH = 8UZ;
+constexpr size_t CAPACITY          = MAX_THREADS * RESULTS_PER_BATCH;
+
+struct LockedBuffer {
+  std::mutex mutex;
+  StaticVector<std::int64_t, CAPACITY> vec;
+
+  void push_back(std::int64_t value) {
+    const std::scoped_lock lock(mutex);
+    vec.push_back(value);
+  }
+  void append(const std::int64_t* values, size_t count) {
+    const std::scoped_lock lock(mutex);
+    vec.append(values, count);
+  }
+  void clear() noexcept { vec.clear(); }
+};
+
+struct LockFreeBuffer {
+  ConcurrentStaticVector<std::int64_t, CAPACITY> vec;
+
+  void push_back(std::int64_t value) noexcept { vec.push_back(value); }
+  void append(const std::int64_t* values, size_t count) noexcept { vec.try_append(values, count); }
+  void clear() noexcept { vec.clear(); }
+};
+
+// The last thread that arrives at the end of a batch drains the buffer.
+template <typename Buffer>
+struct Drain {
+  Buffer* buffer;
+  void operator()() noexcept { buffer->clear(); }
+};
+
+template <typename Buffer>
+struct Shared {
+  Buffer buffer;
+  std::barrier<Drain<Buffer>> batch_done;
+
+  explicit Shared(std::ptrdiff_t threads)
+      : batch_done(threads, Drain<Buffer>{&buffer}) {}
+};
+
+// -------------------------------------------------------------------------------------------------
+// Every thread emits its results one by one, or all at once as a batch.
+template <typename Buffer, bool BATCHED>
+void BM_SharedOutput(benchmark::State& state) {
+  // One buffer and barrier per thread count, created before the threads start their loops and
+  // never destroyed, as other threads may still leave the barrier when the first one finishes.
+  static std::array<std::unique_ptr<Shared<Buffer>>, MAX_THREADS + 1UZ> shared_per_thread_count;
+  auto& shared = shared_per_thread_count[static_cast<size_t>(state.threads())];
+  if (state.thread_index() == 0 && shared == nullptr) {
+    shared = std::make_unique<Shared<Buffer>>(state.threads());
+  }
+
+  std::array<std::int64_t, RESULTS_PER_BATCH> results{};
+  results.fill(state.thread_index());
+  for (auto _ : state) {
+    if constexpr (BATCHED) {
+      shared->buffer.append(results.data(), results.size());
+    } else {
+      for (const auto result : results) {
+        shared->buffer.push_back(result);
+      }
+    }
+    shared->batch_done.arrive_and_wait();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(RESULTS_PER_BATCH));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+BENCHMARK(BM_SharedOutput<LockedBuffer, false>)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+BENCHMARK(BM_SharedOutput<LockFreeBuffer, false>)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+BENCHMARK(BM_SharedOutput<LockedBuffer, true>)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+BENCHMARK(BM_SharedOutput<LockFreeBuffer, true>)->ThreadRange(1, MAX_THREADS)->UseRealTime();
@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "Common.hpp"
+#include "StaticVector.hpp"
+
+namespace {
+
+using bench::Pod64;
+
+// -------------------------------------------------------------------------------------------------
+// Element-wise copy through `push_back`, i.e. what the copy constructor used to do.
+template <typename Element, size_t CAPACITY>
+[[nodiscard]] auto loop_copy(const StaticVector<Element, CAPACITY>& other)
+    -> StaticVector<Element, CAPACITY> {
+  StaticVector<Element, CAPACITY> res;
+  for (const auto& e : other) {
+    res.push_back(e);
+  }
+  return res;
+}
+
+// -------------------------------------------------------------------------------------------------
+template <typename Element, size_t CAPACITY>
+void BM_CopyConstructLoop(benchmark::State& state) {
+  using Vec      = StaticVector<Element, CAPACITY>;
+  const auto src = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    auto dst = loop_copy(src);
+    benchmark::DoNotOptimize(dst);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Element, size_t CAPACITY>
+void BM_CopyConstruct(benchmark::State& state) {
+  using Vec      = StaticVector<Element, CAPACITY>;
+  const auto src = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    StaticVector<Element, CAPACITY> dst(src);
+    benchmark::DoNotOptimize(dst);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Element, size_t CAPACITY>
+void BM_CopyAssign(benchmark::State& state) {
+  using Vec      = StaticVector<Element, CAPACITY>;
+  const auto src = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)));
+  StaticVector<Element, CAPACITY> dst;
+  for (auto _ : state) {
+    dst = src;
+    benchmark::DoNotOptimize(dst);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Element, size_t CAPACITY>
+void BM_CopyConstructOtherCapacity(benchmark::State& state) {
+  using Vec      = StaticVector<Element, CAPACITY>;
+  const auto src = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    StaticVector<Element, 2UZ * CAPACITY> dst(src);
+    benchmark::DoNotOptimize(dst);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Element, size_t CAPACITY>
+void BM_MoveConstruct(benchmark::State& state) {
+  using Vec = StaticVector<Element, CAPACITY>;
+  auto src  = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    StaticVector<Element, CAPACITY> dst(std::move(src));
+    benchmark::DoNotOptimize(dst);
+    src = std::move(dst);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// -------------------------------------------------------------------------------------------------
+// Swapping a full and a half full vector, like the buffers of a double-buffered solver, through a
+// temporary vector as the generic `std::swap` does, against the member swap.
+template <typename Element, size_t CAPACITY>
+void BM_SwapThroughTemporary(benchmark::State& state) {
+  using Vec = StaticVector<Element, CAPACITY>;
+  auto a    = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)));
+  auto b    = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)) / 2UZ);
+  for (auto _ : state) {
+    Vec tmp(std::move(a));
+    a = std::move(b);
+    b = std::move(tmp);
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Element, size_t CAPACITY>
+void BM_Swap(benchmark::State& state) {
+  using Vec = StaticVector<Element, CAPACITY>;
+  auto a    = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)));
+  auto b    = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)) / 2UZ);
+  for (auto _ : state) {
+    swap(a, b);
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(b);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_COPY_BENCHMARKS(Element, CAPACITY)                                                      \
+  BENCHMARK(BM_CopyConstructLoop<Element, CAPACITY>)->Arg(CAPACITY / 4)->Arg(CAPACITY);            \
+  BENCHMARK(BM_CopyConstruct<Element, CAPACITY>)->Arg(CAPACITY / 4)->Arg(CAPACITY);                \
+  BENCHMARK(BM_CopyAssign<Element, CAPACITY>)->Arg(CAPACITY / 4)->Arg(CAPACITY);                   \
+  BENCHMARK(BM_CopyConstructOtherCapacity<Element, CAPACITY>)->Arg(CAPACITY / 4)->Arg(CAPACITY);   \
+  BENCHMARK(BM_MoveConstruct<Element, CAPACITY>)->Arg(CAPACITY / 4)->Arg(CAPACITY);                \
+  BENCHMARK(BM_SwapThroughTemporary<Element, CAPACITY>)->Arg(CAPACITY / 4)->Arg(CAPACITY);         \
+  BENCHMARK(BM_Swap<Element, CAPACITY>)->Arg(CAPACITY / 4)->Arg(CAPACITY)
+
+SV_COPY_BENCHMARKS(int, 16UZ);
+SV_COPY_BENCHMARKS(int, 256UZ);
+SV_COPY_BENCHMARKS(Pod64, 16UZ);
+SV_COPY_BENCHMARKS(Pod64, 256UZ);
+SV_COPY_BENCHMARKS(std::string, 16UZ);
+SV_COPY_BENCHMARKS(std::string, 256UZ);
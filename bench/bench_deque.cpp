@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "StaticDeque.hpp"
+#include "StaticVector.hpp"
+
+// A full sliding window that drops its oldest element for every new one: StaticVector shifts all
+// elements, StaticDeque moves its head.
+
+namespace {
+
+// -------------------------------------------------------------------------------------------------
+template <typename Element, size_t CAPACITY>
+void BM_VectorWindow(benchmark::State& state) {
+  StaticVector<Element, CAPACITY> window;
+  for (size_t i = 0; i < CAPACITY; ++i) {
+    window.push_back(static_cast<Element>(i));
+  }
+
+  std::uint64_t i = CAPACITY;
+  for (auto _ : state) {
+    window.erase(window.begin());
+    window.push_back(static_cast<Element>(i++));
+    benchmark::DoNotOptimize(window.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Element, size_t CAPACITY>
+void BM_DequeWindow(benchmark::State& state) {
+  StaticDeque<Element, CAPACITY> window;
+  for (size_t i = 0; i < CAPACITY; ++i) {
+    window.push_back(static_cast<Element>(i));
+  }
+
+  std::uint64_t i = CAPACITY;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(window.pop_front());
+    window.push_back(static_cast<Element>(i++));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Sum over the window after every step, which crosses the wrap around point.
+template <typename Element, size_t CAPACITY>
+void BM_DequeWindowSum(benchmark::State& state) {
+  StaticDeque<Element, CAPACITY> window;
+  for (size_t i = 0; i < CAPACITY; ++i) {
+    window.push_back(static_cast<Element>(i));
+  }
+
+  std::uint64_t i = CAPACITY;
+  for (auto _ : state) {
+    window.pop_front();
+    window.push_back(static_cast<Element>(i++));
+    Element sum{};
+    for (const auto segment : window.segments()) {
+      for (const auto e : segment) {
+        sum += e;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <typename Element, size_t CAPACITY>
+void BM_DequeWindowSumIterator(benchmark::State& state) {
+  StaticDeque<Element, CAPACITY> window;
+  for (size_t i = 0; i < CAPACITY; ++i) {
+    window.push_back(static_cast<Element>(i));
+  }
+
+  std::uint64_t i = CAPACITY;
+  for (auto _ : state) {
+    window.pop_front();
+    window.push_back(static_cast<Element>(i++));
+    Element sum{};
+    for (const auto e : window) {
+      sum += e;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_DEQUE_BENCHMARKS(Element, CAPACITY)                                                     \
+  BENCHMARK(BM_VectorWindow<Element, CAPACITY>);                                                   \
+  BENCHMARK(BM_DequeWindow<Element, CAPACITY>);                                                    \
+  BENCHMARK(BM_DequeWindowSum<Element, CAPACITY>);                                                 \
+  BENCHMARK(BM_DequeWindowSumIterator<Element, CAPACITY>)
+
+SV_DEQUE_BENCHMARKS(std::uint32_t, 64UZ);
+SV_DEQUE_BENCHMARKS(std::uint32_t, 1000UZ);
+SV_DEQUE_BENCHMARKS(std::uint32_t, 1024UZ);
+SV_DEQUE_BENCHMARKS(double, 1024UZ);
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+
+#include "Algorithm.hpp"
+#include "StaticVector.hpp"
+
+// In-place filtering of a full vector of random values in [0, 100): `erase_if` with a vectorized
+// comparison, `erase_if` with a lambda, which takes the branchless scalar path, and the
+// erase-remove idiom with `std::remove_if`. The argument is the percentage of kept elements.
+// Every iteration filters a fresh copy of the input, the copy is part of the measured time for all
+// variants.
+
+namespace {
+
+constexpr size_t CAPACITY = 1024UZ;
+
+enum class Algo : std::uint8_t { SIMD, BRANCHLESS, STD };
+
+template <typename Element>
+[[nodiscard]] auto make_input() -> StaticVector<Element, CAPACITY> {
+  std::mt19937 rng(42);  // NOLINT
+  std::uniform_int_distribution<int> dist(0, 99);
+  StaticVector<Element, CAPACITY> vec;
+  for (size_t i = 0; i < CAPACITY; ++i) {
+    vec.push_back(static_cast<Element>(dist(rng)));
+  }
+  return vec;
+}
+
+// -------------------------------------------------------------------------------------------------
+template <typename Element, Algo ALGO>
+void BM_EraseIf(benchmark::State& state) {
+  const auto input = make_input<Element>();
+  auto limit       = static_cast<Element>(state.range(0));
+  for (auto _ : state) {
+    auto vec = input;
+    benchmark::DoNotOptimize(limit);
+    if constexpr (ALGO == Algo::SIMD) {
+      erase_if(vec, compare_with<std::greater_equal<>>(limit));
+    } else if constexpr (ALGO == Algo::BRANCHLESS) {
+      erase_if(vec, [limit](Element e) { return e >= limit; });
+    } else {
+      vec.erase(std::remove_if(vec.begin(), vec.end(), [limit](Element e) { return e >= limit; }),
+                vec.end());
+    }
+    benchmark::DoNotOptimize(vec);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_ERASE_BENCHMARKS(Element)                                                               \
+  BENCHMARK(BM_EraseIf<Element, Algo::SIMD>)->Arg(0)->Arg(10)->Arg(50)->Arg(90)->Arg(100);         \
+  BENCHMARK(BM_EraseIf<Element, Algo::BRANCHLESS>)->Arg(0)->Arg(10)->Arg(50)->Arg(90)->Arg(100);   \
+  BENCHMARK(BM_EraseIf<Element, Algo::STD>)->Arg(0)->Arg(10)->Arg(50)->Arg(90)->Arg(100)
+
+SV_ERASE_BENCHMARKS(std::int32_t);
+SV_ERASE_BENCHMARKS(float);
+SV_ERASE_BENCHMARKS(std::int64_t);
+SV_ERASE_BENCHMARKS(std::uint8_t);
@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+
+#include "StaticVector.hpp"
+
+// Every thread fills and clears its own small vector in a shared array, as in per-thread state.
+// Element aligned vectors pack several per cache line, so the threads invalidate each others lines
+// (false sharing); cache line isolated vectors each own their line.
+
+namespace {
+
+constexpr size_t MAX_THREADS = 16UZ;
+constexpr size_t CAPACITY    = 4UZ;
+
+template <typename Alignment>
+using PerThread = std::array<StaticVector<std::int32_t, CAPACITY, Alignment>, MAX_THREADS>;
+
+// -------------------------------------------------------------------------------------------------
+template <typename Alignment>
+void BM_PerThreadPushBack(benchmark::State& state) {
+  static PerThread<Alignment> per_thread{};
+  auto& vec = per_thread[static_cast<size_t>(state.thread_index()) % MAX_THREADS];
+
+  std::int32_t i = 0;
+  for (auto _ : state) {
+    if (vec.size() == vec.capacity()) {
+      vec.clear();
+    }
+    vec.push_back(i++);
+    // Force the store to the vector in every iteration.
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+static_assert(sizeof(PerThread<ElementAligned>) < MAX_THREADS * CACHE_LINE_SIZE);
+static_assert(sizeof(PerThread<CacheLineIsolated>) == MAX_THREADS * CACHE_LINE_SIZE);
+
+BENCHMARK(BM_PerThreadPushBack<ElementAligned>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_PerThreadPushBack<SimdAligned>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_PerThreadPushBack<CacheLineIsolated>)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "Algorithm.hpp"
+#include "StaticVector.hpp"
+
+// Linear membership checks: the vectorized `find`, `count` and `contains` against their scalar
+// counterparts from <algorithm>. The argument is the fill ratio of the vector in percent; a hit
+// searches for the element in the middle of the vector, a miss for a value that is not contained.
+
+namespace {
+
+enum class Search : std::uint8_t { HIT, MISS };
+
+template <typename Element, size_t CAPACITY>
+[[nodiscard]] auto make_filled(const benchmark::State& state) -> StaticVector<Element, CAPACITY> {
+  const auto size = std::max(CAPACITY * static_cast<size_t>(state.range(0)) / 100UZ, 1UZ);
+  StaticVector<Element, CAPACITY> vec;
+  for (size_t i = 0; i < size; ++i) {
+    vec.push_back(static_cast<Element>(i + 1UZ));
+  }
+  return vec;
+}
+
+template <typename Element, size_t CAPACITY, Search SEARCH>
+[[nodiscard]] auto searched_value(const StaticVector<Element, CAPACITY>& vec) -> Element {
+  if constexpr (SEARCH == Search::HIT) {
+    return vec[vec.size() / 2UZ];
+  } else {
+    return static_cast<Element>(0);
+  }
+}
+
+void set_counters(benchmark::State& state, size_t size, size_t element_size) {
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size * element_size));
+}
+
+// -------------------------------------------------------------------------------------------------
+template <typename Element, size_t CAPACITY, Search SEARCH>
+void BM_Find(benchmark::State& state) {
+  const auto vec = make_filled<Element, CAPACITY>(state);
+  auto value     = searched_value<Element, CAPACITY, SEARCH>(vec);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(value);
+    benchmark::DoNotOptimize(find(vec, value));
+  }
+  set_counters(state, vec.size(), sizeof(Element));
+}
+
+template <typename Element, size_t CAPACITY, Search SEARCH>
+void BM_StdFind(benchmark::State& state) {
+  const auto vec = make_filled<Element, CAPACITY>(state);
+  auto value     = searched_value<Element, CAPACITY, SEARCH>(vec);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(value);
+    benchmark::DoNotOptimize(std::find(vec.begin(), vec.end(), value));
+  }
+  set_counters(state, vec.size(), sizeof(Element));
+}
+
+template <typename Element, size_t CAPACITY, Search SEARCH>
+void BM_Contains(benchmark::State& state) {
+  const auto vec = make_filled<Element, CAPACITY>(state);
+  auto value     = searched_value<Element, CAPACITY, SEARCH>(vec);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(value);
+    benchmark::DoNotOptimize(contains(vec, value));
+  }
+  set_counters(state, vec.size(), sizeof(Element));
+}
+
+template <typename Element, size_t CAPACITY>
+void BM_Count(benchmark::State& state) {
+  const auto vec = make_filled<Element, CAPACITY>(state);
+  auto value     = searched_value<Element, CAPACITY, Search::HIT>(vec);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(value);
+    benchmark::DoNotOptimize(count(vec, value));
+  }
+  set_counters(state, vec.size(), sizeof(Element));
+}
+
+template <typename Element, size_t CAPACITY>
+void BM_StdCount(benchmark::State& state) {
+  const auto vec = make_filled<Element, CAPACITY>(state);
+  auto value     = searched_value<Element, CAPACITY, Search::HIT>(vec);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(value);
+    benchmark::DoNotOptimize(std::count(vec.begin(), vec.end(), value));
+  }
+  set_counters(state, vec.size(), sizeof(Element));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_FIND_BENCHMARKS(Element, CAPACITY)                                                      \
+  BENCHMARK(BM_Find<Element, CAPACITY, Search::HIT>)->Arg(25)->Arg(50)->Arg(100);                  \
+  BENCHMARK(BM_StdFind<Element, CAPACITY, Search::HIT>)->Arg(25)->Arg(50)->Arg(100);               \
+  BENCHMARK(BM_Find<Element, CAPACITY, Search::MISS>)->Arg(25)->Arg(50)->Arg(100);                 \
+  BENCHMARK(BM_StdFind<Element, CAPACITY, Search::MISS>)->Arg(25)->Arg(50)->Arg(100);              \
+  BENCHMARK(BM_Contains<Element, CAPACITY, Search::MISS>)->Arg(25)->Arg(50)->Arg(100);             \
+  BENCHMARK(BM_Count<Element, CAPACITY>)->Arg(25)->Arg(50)->Arg(100);                              \
+  BENCHMARK(BM_StdCount<Element, CAPACITY>)->Arg(25)->Arg(50)->Arg(100)
+
+SV_FIND_BENCHMARKS(std::uint32_t, 64UZ);
+SV_FIND_BENCHMARKS(std::uint8_t, 64UZ);
+SV_FIND_BENCHMARKS(std::uint16_t, 1024UZ);
+SV_FIND_BENCHMARKS(std::uint32_t, 1024UZ);
+SV_FIND_BENCHMARKS(double, 1024UZ);
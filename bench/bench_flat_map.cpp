@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __cpp_lib_flat_map
+#include <flat_map>
+#endif
+
+#include "StaticFlatMap.hpp"
+
+// Small sorted tables of `SIZE` entries: StaticFlatMap against the node based std::map, the hash
+// based std::unordered_map and, where the standard library provides it, std::flat_map. The keys
+// are the even numbers below 2 * SIZE, so half of the random lookups miss.
+
+namespace {
+
+using Key   = std::uint32_t;
+using Value = std::uint64_t;
+
+template <size_t SIZE>
+using FlatMap = StaticFlatMap<Key, Value, SIZE>;
+
+constexpr size_t LOOKUPS = 1024UZ;
+
+template <typename Map, size_t SIZE>
+[[nodiscard]] auto make_map() -> Map {
+  Map map;
+  for (size_t i = 0; i < SIZE; ++i) {
+    map.insert({static_cast<Key>(2UZ * i), static_cast<Value>(i)});
+  }
+  return map;
+}
+
+// Random keys in [0, 2 * SIZE), every second one is contained.
+template <size_t SIZE>
+[[nodiscard]] auto make_lookups() -> std::vector<Key> {
+  std::mt19937 rng(42);  // NOLINT
+  std::uniform_int_distribution<Key> dist(0U, static_cast<Key>((2UZ * SIZE) - 1UZ));
+  std::vector<Key> keys(LOOKUPS);
+  for (auto& key : keys) {
+    key = dist(rng);
+  }
+  return keys;
+}
+
+// -------------------------------------------------------------------------------------------------
+template <typename Map, size_t SIZE>
+void BM_Find(benchmark::State& state) {
+  const auto map     = make_map<Map, SIZE>();
+  const auto lookups = make_lookups<SIZE>();
+
+  size_t i = 0UZ;
+  for (auto _ : state) {
+    const auto it = map.find(lookups[i++ % LOOKUPS]);
+    benchmark::DoNotOptimize(it != map.end());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Every iteration erases a random entry and inserts it again, the size stays at `SIZE`.
+template <typename Map, size_t SIZE>
+void BM_EraseInsert(benchmark::State& state) {
+  auto map           = make_map<Map, SIZE>();
+  const auto lookups = make_lookups<SIZE>();
+
+  size_t i = 0UZ;
+  for (auto _ : state) {
+    const auto key = lookups[i++ % LOOKUPS] & ~Key{1};
+    map.erase(key);
+    map.insert({key, Value{key}});
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Fill an empty map: sorted bulk load for StaticFlatMap, insertion in order for the others.
+template <typename Map, size_t SIZE>
+void BM_Build(benchmark::State& state) {
+  std::vector<Key> keys(SIZE);
+  std::vector<Value> values(SIZE);
+  for (size_t i = 0; i < SIZE; ++i) {
+    keys[i]   = static_cast<Key>(2UZ * i);
+    values[i] = static_cast<Value>(i);
+  }
+
+  for (auto _ : state) {
+    Map map;
+    if constexpr (std::is_same_v<Map, FlatMap<SIZE>>) {
+      map.assign_sorted(keys, values);
+    } else {
+      for (size_t i = 0; i < SIZE; ++i) {
+        map.insert({keys[i], values[i]});
+      }
+    }
+    benchmark::DoNotOptimize(map);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(SIZE));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#ifdef __cpp_lib_flat_map
+#define SV_STD_FLAT_MAP_BENCHMARK(Bench, SIZE) BENCHMARK(Bench<std::flat_map<Key, Value>, SIZE>)
+#else
+#define SV_STD_FLAT_MAP_BENCHMARK(Bench, SIZE) static_assert(true)
+#endif
+
+#define SV_FLAT_MAP_BENCHMARKS(Bench, SIZE)                                                        \
+  BENCHMARK(Bench<FlatMap<SIZE>, SIZE>);                                                           \
+  BENCHMARK(Bench<std::map<Key, Value>, SIZE>);                                                    \
+  BENCHMARK(Bench<std::unordered_map<Key, Value>, SIZE>);                                          \
+  SV_STD_FLAT_MAP_BENCHMARK(Bench, SIZE)
+
+SV_FLAT_MAP_BENCHMARKS(BM_Find, 8UZ);
+SV_FLAT_MAP_BENCHMARKS(BM_Find, 16UZ);
+SV_FLAT_MAP_BENCHMARKS(BM_Find, 32UZ);
+SV_FLAT_MAP_BENCHMARKS(BM_Find, 64UZ);
+SV_FLAT_MAP_BENCHMARKS(BM_Find, 128UZ);
+
+SV_FLAT_MAP_BENCHMARKS(BM_EraseInsert, 8UZ);
+SV_FLAT_MAP_BENCHMARKS(BM_EraseInsert, 16UZ);
+SV_FLAT_MAP_BENCHMARKS(BM_EraseInsert, 32UZ);
+SV_FLAT_MAP_BENCHMARKS(BM_EraseInsert, 64UZ);
+
+SV_FLAT_MAP_BENCHMARKS(BM_Build, 8UZ);
+SV_FLAT_MAP_BENCHMARKS(BM_Build, 64UZ);
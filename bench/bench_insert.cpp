@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Common.hpp"
+#include "StaticVector.hpp"
+
+namespace {
+
+enum class Position : std::uint8_t { FRONT, MIDDLE, BACK };
+
+template <typename Vec>
+[[nodiscard]] auto position(Vec& vec, Position pos) {
+  switch (pos) {
+    case Position::FRONT:  return vec.begin();
+    case Position::MIDDLE: return vec.begin() + static_cast<std::ptrdiff_t>(vec.size() / 2UZ);
+    case Position::BACK:   return vec.end();
+  }
+  return vec.end();
+}
+
+// -------------------------------------------------------------------------------------------------
+// Inserts one element and erases it again, such that the size stays constant.
+template <typename Vec, Position POS>
+void BM_InsertErase(benchmark::State& state) {
+  auto vec         = bench::make_vector<Vec>(static_cast<size_t>(state.range(0)));
+  const auto value = bench::make_element<typename Vec::value_type>(42UZ);
+  if constexpr (requires { vec.reserve(vec.size() + 1UZ); }) {
+    vec.reserve(vec.size() + 1UZ);
+  }
+  for (auto _ : state) {
+    auto it = vec.insert(position(vec, POS), value);
+    benchmark::DoNotOptimize(it);
+    vec.erase(it);
+    benchmark::ClobberMemory();
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Builds a sorted vector by inserting random values at their lower bound.
+template <typename Vec>
+void BM_OrderedInsert(benchmark::State& state) {
+  using Element   = typename Vec::value_type;
+  const auto size = static_cast<size_t>(state.range(0));
+
+  std::mt19937 gen(42);  // NOLINT(cert-msc32-c, cert-msc51-cpp)
+  std::vector<Element> values(size);
+  std::ranges::generate(values, [&] { return bench::make_element<Element>(gen() % 1'000'000UZ); });
+
+  for (auto _ : state) {
+    Vec vec;
+    if constexpr (requires { vec.reserve(size); }) {
+      vec.reserve(size);
+    }
+    for (const auto& v : values) {
+      vec.insert(std::lower_bound(vec.begin(), vec.end(), v), v);
+    }
+    benchmark::DoNotOptimize(vec);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_INSERT_BENCHMARKS(Element, CAPACITY)                                                    \
+  BENCHMARK(BM_InsertErase<StaticVector<Element, CAPACITY>, Position::FRONT>)->Arg(CAPACITY - 1);  \
+  BENCHMARK(BM_InsertErase<std::vector<Element>, Position::FRONT>)->Arg(CAPACITY - 1);             \
+  BENCHMARK(BM_InsertErase<StaticVector<Element, CAPACITY>, Position::MIDDLE>)->Arg(CAPACITY - 1); \
+  BENCHMARK(BM_InsertErase<std::vector<Element>, Position::MIDDLE>)->Arg(CAPACITY - 1);            \
+  BENCHMARK(BM_InsertErase<StaticVector<Element, CAPACITY>, Position::BACK>)->Arg(CAPACITY - 1);   \
+  BENCHMARK(BM_InsertErase<std::vector<Element>, Position::BACK>)->Arg(CAPACITY - 1);              \
+  BENCHMARK(BM_OrderedInsert<StaticVector<Element, CAPACITY>>)->Arg(CAPACITY);                     \
+  BENCHMARK(BM_OrderedInsert<std::vector<Element>>)->Arg(CAPACITY)
+
+SV_INSERT_BENCHMARKS(int, 16UZ);
+SV_INSERT_BENCHMARKS(int, 256UZ);
+SV_INSERT_BENCHMARKS(std::string, 16UZ);
+SV_INSERT_BENCHMARKS(std::string, 256UZ);
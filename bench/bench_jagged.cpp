@@ -0,0 +1,117 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "StaticJaggedArray.hpp"
+#include "StaticVector.hpp"
+
+// Adjacency lists of a graph with mostly two or three neighbours per node, stored as a vector of
+// StaticVectors with room for 32 neighbours against a StaticJaggedArray with room for four on
+// average. The `bytes` counter is the memory that holds the lists.
+
+namespace {
+
+constexpr size_t NODES     = 4096UZ;
+constexpr size_t MAX_EDGES = 32UZ;
+
+using Rows   = std::vector<StaticVector<std::uint32_t, MAX_EDGES>>;
+using Jagged = StaticJaggedArray<std::uint32_t, NODES, NODES * 4UZ>;
+
+[[nodiscard]] auto make_rows() -> Rows {
+  std::mt19937 rng(42);  // NOLINT
+  std::discrete_distribution<size_t> degree({1.0, 4.0, 4.0, 1.0});
+  std::uniform_int_distribution<std::uint32_t> node(0U, NODES - 1U);
+  Rows rows(NODES);
+  for (auto& row : rows) {
+    const auto count = degree(rng) + 1UZ;
+    for (size_t i = 0; i < count; ++i) {
+      row.push_back(node(rng));
+    }
+  }
+  return rows;
+}
+
+[[nodiscard]] auto make_jagged(const Rows& rows) -> std::unique_ptr<Jagged> {
+  auto builder = std::make_unique<Jagged::Builder>();
+  for (const auto& row : rows) {
+    builder->push_row(row);
+  }
+  return std::make_unique<Jagged>(std::move(*builder));
+}
+
+// -------------------------------------------------------------------------------------------------
+// Sums the neighbours of every node in order.
+void BM_Scan_VectorOfStaticVector(benchmark::State& state) {
+  const auto rows = make_rows();
+  for (auto _ : state) {
+    std::uint64_t sum = 0U;
+    for (const auto& row : rows) {
+      for (const auto n : row) {
+        sum += n;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NODES));
+  state.counters["bytes"] = static_cast<double>(rows.size() * sizeof(rows[0]));
+}
+
+void BM_Scan_Jagged(benchmark::State& state) {
+  const auto jagged = make_jagged(make_rows());
+  for (auto _ : state) {
+    std::uint64_t sum = 0U;
+    for (const auto row : *jagged) {
+      for (const auto n : row) {
+        sum += n;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NODES));
+  state.counters["bytes"] = static_cast<double>(sizeof(Jagged));
+}
+
+// Follows the first neighbour of every node and sums the degrees of the neighbours, which visits
+// the rows in random order.
+void BM_Hop_VectorOfStaticVector(benchmark::State& state) {
+  const auto rows = make_rows();
+  for (auto _ : state) {
+    std::uint64_t sum = 0U;
+    for (const auto& row : rows) {
+      for (const auto n : rows[row[0]]) {
+        sum += rows[n].size();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NODES));
+  state.counters["bytes"] = static_cast<double>(rows.size() * sizeof(rows[0]));
+}
+
+void BM_Hop_Jagged(benchmark::State& state) {
+  const auto jagged_ptr = make_jagged(make_rows());
+  const auto& jagged    = *jagged_ptr;
+  for (auto _ : state) {
+    std::uint64_t sum = 0U;
+    for (const auto row : jagged) {
+      for (const auto n : jagged[row[0]]) {
+        sum += jagged[n].size();
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NODES));
+  state.counters["bytes"] = static_cast<double>(sizeof(Jagged));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+BENCHMARK(BM_Scan_VectorOfStaticVector);
+BENCHMARK(BM_Scan_Jagged);
+BENCHMARK(BM_Hop_VectorOfStaticVector);
+BENCHMARK(BM_Hop_Jagged);
@@ -0,0 +1,174 @@
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "MappedStaticVector.hpp"
+#include "StaticVector.hpp"
+
+// Startup from a checkpoint of `COUNT` vectors: mapping a file written by `write_static_vectors`
+// against reading a stream of sizes and elements and rebuilding the vectors element by element.
+// Every iteration opens the file again, so the mapping pays its page faults every time. The plain
+// cases keep the page cache warm; the `Cold` cases evict both files from it before every iteration,
+// which only takes effect if the temporary directory is on a disk and not on a tmpfs.
+
+namespace {
+
+struct PodRecord {
+  std::uint64_t key;
+  std::uint32_t port;
+  std::uint32_t weight;
+};
+
+constexpr size_t CAPACITY = 32UZ;
+constexpr size_t COUNT    = 8192UZ;
+
+using Vector = StaticVector<PodRecord, CAPACITY>;
+
+[[nodiscard]] auto make_vectors() -> std::vector<Vector> {
+  std::vector<Vector> vectors(COUNT);
+  for (size_t i = 0; i < COUNT; ++i) {
+    for (size_t j = 0; j < (i * 7UZ) % (CAPACITY + 1UZ); ++j) {
+      vectors[i].push_back(PodRecord{.key    = i,
+                                     .port   = static_cast<std::uint32_t>(j),
+                                     .weight = static_cast<std::uint32_t>(i + j)});
+    }
+  }
+  return vectors;
+}
+
+// Both checkpoint files, written once and removed at exit.
+struct Checkpoints {
+  std::string mapped = (std::filesystem::temp_directory_path() / "sv_bench_mapped.bin").string();
+  std::string stream = (std::filesystem::temp_directory_path() / "sv_bench_stream.bin").string();
+
+  Checkpoints() {
+    const auto vectors = make_vectors();
+    if (!write_static_vectors(mapped.c_str(), vectors).has_value()) { std::abort(); }
+
+    std::ofstream out(stream, std::ios::binary);
+    for (const auto& vec : vectors) {
+      const auto size = static_cast<std::uint32_t>(vec.size());
+      out.write(reinterpret_cast<const char*>(&size), sizeof(size));  // NOLINT
+      for (const auto& record : vec) {
+        out.write(reinterpret_cast<const char*>(&record), sizeof(record));  // NOLINT
+      }
+    }
+  }
+  Checkpoints(const Checkpoints&)                    = delete;
+  auto operator=(const Checkpoints&) -> Checkpoints& = delete;
+  ~Checkpoints() {
+    std::filesystem::remove(mapped);
+    std::filesystem::remove(stream);
+  }
+};
+
+[[nodiscard]] auto checkpoints() -> const Checkpoints& {
+  static const Checkpoints files;
+  return files;
+}
+
+// Writes the file back and asks the kernel to drop it from the page cache, such that the next read
+// goes to the disk. This is a hint, the kernel may keep some of the pages.
+void evict_from_page_cache(const std::string& path) {
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) { std::abort(); }
+  ::fdatasync(fd);
+  ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+  ::close(fd);
+}
+
+// Touches every vector like the first pass over the restored state would.
+template <typename Vectors>
+[[nodiscard]] auto total_weight(const Vectors& vectors) noexcept -> std::uint64_t {
+  std::uint64_t sum = 0U;
+  for (const auto& vec : vectors) {
+    for (const auto& record : vec) {
+      sum += record.weight;
+    }
+  }
+  return sum;
+}
+
+// -------------------------------------------------------------------------------------------------
+void BM_MapCheckpoint(benchmark::State& state) {
+  const auto& files = checkpoints();
+  for (auto _ : state) {
+    const auto mapped = MappedStaticVectors<PodRecord, CAPACITY>::open(files.mapped.c_str());
+    benchmark::DoNotOptimize(total_weight(*mapped));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(COUNT));
+}
+
+// Only the header is checked, no vector is accessed.
+void BM_MapCheckpointOpenOnly(benchmark::State& state) {
+  const auto& files = checkpoints();
+  for (auto _ : state) {
+    const auto mapped = MappedStaticVectors<PodRecord, CAPACITY>::open(files.mapped.c_str());
+    benchmark::DoNotOptimize(mapped->size());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(COUNT));
+}
+
+[[nodiscard]] auto deserialize(const std::string& path) -> std::vector<Vector> {
+  std::ifstream in(path, std::ios::binary);
+  std::vector<Vector> vectors(COUNT);
+  for (auto& vec : vectors) {
+    std::uint32_t size = 0U;
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));  // NOLINT
+    for (std::uint32_t i = 0; i < size; ++i) {
+      PodRecord record{};
+      in.read(reinterpret_cast<char*>(&record), sizeof(record));  // NOLINT
+      vec.push_back(record);
+    }
+  }
+  return vectors;
+}
+
+void BM_DeserializeCheckpoint(benchmark::State& state) {
+  const auto& files = checkpoints();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(total_weight(deserialize(files.stream)));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(COUNT));
+}
+
+// -------------------------------------------------------------------------------------------------
+// Waiting for the disk costs no CPU time, so these cases are measured in wall-clock time.
+void BM_MapCheckpointCold(benchmark::State& state) {
+  const auto& files = checkpoints();
+  for (auto _ : state) {
+    state.PauseTiming();
+    evict_from_page_cache(files.mapped);
+    state.ResumeTiming();
+    const auto mapped = MappedStaticVectors<PodRecord, CAPACITY>::open(files.mapped.c_str());
+    benchmark::DoNotOptimize(total_weight(*mapped));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(COUNT));
+}
+
+void BM_DeserializeCheckpointCold(benchmark::State& state) {
+  const auto& files = checkpoints();
+  for (auto _ : state) {
+    state.PauseTiming();
+    evict_from_page_cache(files.stream);
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(total_weight(deserialize(files.stream)));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(COUNT));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+BENCHMARK(BM_MapCheckpoint);
+BENCHMARK(BM_MapCheckpointOpenOnly);
+BENCHMARK(BM_DeserializeCheckpoint);
+BENCHMARK(BM_MapCheckpointCold)->UseRealTime();
+BENCHMARK(BM_DeserializeCheckpointCold)->UseRealTime();
@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+#include "PackedStaticVector.hpp"
+#include "StaticVector.hpp"
+
+// PackedStaticVector against a StaticVector of the same values, for bools and 4-bit codes. The
+// packed vector counts and searches a word at a time, the unpacked one relies on the vectorization
+// of the standard algorithms. The `bytes` counter is the size of the vector.
+
+namespace {
+
+constexpr size_t CAPACITY = 1024UZ;
+
+enum class Layout : std::uint8_t { PACKED, UNPACKED };
+
+template <size_t BITS, Layout LAYOUT>
+using Vec = std::conditional_t<LAYOUT == Layout::PACKED,
+                               PackedStaticVector<BITS, CAPACITY>,
+                               StaticVector<typename PackedStaticVector<BITS, 1UZ>::value_type,
+                                            CAPACITY>>;
+
+// A full vector of random values below 2^BITS, where the value 1 occurs once near the end, so
+// that finding it scans the whole vector.
+template <size_t BITS, Layout LAYOUT>
+[[nodiscard]] auto make_input() -> Vec<BITS, LAYOUT> {
+  using Value = typename Vec<BITS, LAYOUT>::value_type;
+  std::mt19937 rng(42);  // NOLINT
+  std::uniform_int_distribution<unsigned> dist(0U, (1U << BITS) - 1U);
+  Vec<BITS, LAYOUT> vec;
+  for (size_t i = 0; i < CAPACITY; ++i) {
+    const auto value = dist(rng);
+    vec.push_back(static_cast<Value>(value == 1U ? 0U : value));
+  }
+  vec[CAPACITY - 10UZ] = 1U;
+  return vec;
+}
+
+template <size_t BITS, Layout LAYOUT>
+void set_counters(benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+  state.counters["bytes"] = static_cast<double>(sizeof(Vec<BITS, LAYOUT>));
+}
+
+// -------------------------------------------------------------------------------------------------
+template <size_t BITS, Layout LAYOUT>
+void BM_Count(benchmark::State& state) {
+  auto vec = make_input<BITS, LAYOUT>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec);
+    if constexpr (LAYOUT == Layout::PACKED) {
+      benchmark::DoNotOptimize(vec.count(0U));
+    } else {
+      benchmark::DoNotOptimize(std::ranges::count(vec, 0U));
+    }
+  }
+  set_counters<BITS, LAYOUT>(state);
+}
+
+template <size_t BITS, Layout LAYOUT>
+void BM_FindFirst(benchmark::State& state) {
+  auto vec = make_input<BITS, LAYOUT>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec);
+    if constexpr (LAYOUT == Layout::PACKED) {
+      benchmark::DoNotOptimize(vec.find_first(1U));
+    } else {
+      benchmark::DoNotOptimize(std::ranges::find(vec, 1U));
+    }
+  }
+  set_counters<BITS, LAYOUT>(state);
+}
+
+template <size_t BITS, Layout LAYOUT>
+void BM_Fill(benchmark::State& state) {
+  auto vec = make_input<BITS, LAYOUT>();
+  for (auto _ : state) {
+    if constexpr (LAYOUT == Layout::PACKED) {
+      vec.fill(1U);
+    } else {
+      std::ranges::fill(vec, 1U);
+    }
+    benchmark::DoNotOptimize(vec);
+  }
+  set_counters<BITS, LAYOUT>(state);
+}
+
+// Element-wise reads through operator[], where the packed vector shifts and masks every field.
+template <size_t BITS, Layout LAYOUT>
+void BM_IndexSum(benchmark::State& state) {
+  auto vec = make_input<BITS, LAYOUT>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vec);
+    const auto& cvec = vec;
+    unsigned sum     = 0U;
+    for (size_t i = 0; i < cvec.size(); ++i) {
+      sum += cvec[i];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  set_counters<BITS, LAYOUT>(state);
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_PACKED_BENCHMARKS(BITS)                                                                 \
+  BENCHMARK(BM_Count<BITS, Layout::PACKED>);                                                       \
+  BENCHMARK(BM_Count<BITS, Layout::UNPACKED>);                                                     \
+  BENCHMARK(BM_FindFirst<BITS, Layout::PACKED>);                                                   \
+  BENCHMARK(BM_FindFirst<BITS, Layout::UNPACKED>);                                                 \
+  BENCHMARK(BM_Fill<BITS, Layout::PACKED>);                                                        \
+  BENCHMARK(BM_Fill<BITS, Layout::UNPACKED>);                                                      \
+  BENCHMARK(BM_IndexSum<BITS, Layout::PACKED>);                                                    \
+  BENCHMARK(BM_IndexSum<BITS, Layout::UNPACKED>)
+
+SV_PACKED_BENCHMARKS(1UZ);
+SV_PACKED_BENCHMARKS(4UZ);
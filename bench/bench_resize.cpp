@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "StaticVector.hpp"
+
+namespace {
+
+constexpr size_t CAPACITY = 4096UZ;
+
+// -------------------------------------------------------------------------------------------------
+template <typename Element>
+void BM_Resize(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  StaticVector<Element, CAPACITY> vec;
+  for (auto _ : state) {
+    vec.clear();
+    vec.resize(size);
+    benchmark::DoNotOptimize(vec.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<int64_t>(sizeof(Element)));
+}
+
+template <typename Element>
+void BM_ResizeValue(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  StaticVector<Element, CAPACITY> vec;
+  for (auto _ : state) {
+    vec.clear();
+    vec.resize(size, static_cast<Element>(42));
+    benchmark::DoNotOptimize(vec.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<int64_t>(sizeof(Element)));
+}
+
+template <typename Element>
+void BM_ResizeForOverwrite(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  StaticVector<Element, CAPACITY> vec;
+  for (auto _ : state) {
+    vec.clear();
+    vec.resize_for_overwrite(size);
+    benchmark::DoNotOptimize(vec.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<int64_t>(sizeof(Element)));
+}
+
+// Decoding into the buffer: `resize` initializes the memory that is overwritten right after.
+template <typename Element, bool FOR_OVERWRITE>
+void BM_Decode(benchmark::State& state) {
+  const auto size = static_cast<size_t>(state.range(0));
+  StaticVector<Element, CAPACITY> src(size, static_cast<Element>(1));
+  StaticVector<Element, CAPACITY> vec;
+  for (auto _ : state) {
+    vec.clear();
+    if constexpr (FOR_OVERWRITE) {
+      vec.resize_for_overwrite(size);
+    } else {
+      vec.resize(size);
+    }
+    benchmark::ClobberMemory();
+    std::memcpy(vec.data(), src.data(), size * sizeof(Element));
+    benchmark::DoNotOptimize(vec.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<int64_t>(sizeof(Element)));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_RESIZE_BENCHMARKS(Element)                                                              \
+  BENCHMARK(BM_Resize<Element>)->Arg(64)->Arg(CAPACITY);                                           \
+  BENCHMARK(BM_ResizeValue<Element>)->Arg(64)->Arg(CAPACITY);                                      \
+  BENCHMARK(BM_ResizeForOverwrite<Element>)->Arg(64)->Arg(CAPACITY);                               \
+  BENCHMARK(BM_Decode<Element, false>)->Arg(64)->Arg(CAPACITY);                                    \
+  BENCHMARK(BM_Decode<Element, true>)->Arg(64)->Arg(CAPACITY)
+
+SV_RESIZE_BENCHMARKS(std::uint8_t);
+SV_RESIZE_BENCHMARKS(int);
+SV_RESIZE_BENCHMARKS(double);
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+
+#include "Common.hpp"
+#include "StaticVector.hpp"
+
+// Reverse traversal of a full StaticVector through `rbegin()`/`rend()`, against a reversed index
+// loop and `std::reverse_iterator` over the raw pointers as the reference the compiler should be
+// able to match.
+
+namespace {
+
+constexpr size_t CAPACITY = 4096UZ;
+
+template <typename Element>
+using Vec = StaticVector<Element, CAPACITY>;
+
+// -------------------------------------------------------------------------------------------------
+template <typename Element>
+void BM_ReverseSum_Iterator(benchmark::State& state) {
+  const auto vec = bench::make_vector<Vec<Element>>(CAPACITY);
+  for (auto _ : state) {
+    Element sum{};
+    for (auto it = vec.rbegin(); it != vec.rend(); ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <typename Element>
+void BM_ReverseSum_Index(benchmark::State& state) {
+  const auto vec = bench::make_vector<Vec<Element>>(CAPACITY);
+  for (auto _ : state) {
+    Element sum{};
+    for (size_t i = vec.size(); i > 0; --i) {
+      sum += vec[i - 1];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <typename Element>
+void BM_ReverseSum_StdReverseIterator(benchmark::State& state) {
+  const auto vec = bench::make_vector<Vec<Element>>(CAPACITY);
+  for (auto _ : state) {
+    Element sum{};
+    const auto last = std::make_reverse_iterator(vec.begin());
+    for (auto it = std::make_reverse_iterator(vec.end()); it != last; ++it) {
+      sum += *it;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+// -------------------------------------------------------------------------------------------------
+template <typename Element>
+void BM_ReverseCopy_Iterator(benchmark::State& state) {
+  const auto src = bench::make_vector<Vec<Element>>(CAPACITY);
+  Vec<Element> dst(CAPACITY);
+  for (auto _ : state) {
+    std::ranges::copy(src.rbegin(), src.rend(), dst.begin());
+    benchmark::DoNotOptimize(dst);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <typename Element>
+void BM_ReverseCopy_StdReverseCopy(benchmark::State& state) {
+  const auto src = bench::make_vector<Vec<Element>>(CAPACITY);
+  Vec<Element> dst(CAPACITY);
+  for (auto _ : state) {
+    std::ranges::reverse_copy(src, dst.begin());
+    benchmark::DoNotOptimize(dst);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_REVERSE_BENCHMARKS(Element)                                                             \
+  BENCHMARK(BM_ReverseSum_Iterator<Element>);                                                      \
+  BENCHMARK(BM_ReverseSum_Index<Element>);                                                         \
+  BENCHMARK(BM_ReverseSum_StdReverseIterator<Element>);                                            \
+  BENCHMARK(BM_ReverseCopy_Iterator<Element>);                                                     \
+  BENCHMARK(BM_ReverseCopy_StdReverseCopy<Element>)
+
+SV_REVERSE_BENCHMARKS(std::int32_t);
+SV_REVERSE_BENCHMARKS(float);
+SV_REVERSE_BENCHMARKS(std::uint64_t);
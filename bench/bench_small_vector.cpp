@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Common.hpp"
+#include "SmallVector.hpp"
+#include "StaticVector.hpp"
+
+// The inline path of SmallVector against StaticVector and against std::vector with reserved
+// capacity. The spill path against a fresh std::vector.
+//
+// `push_back` of StaticVector does not check the capacity in release builds, so the like-for-like
+// pairs are `unchecked_push_back` of both vectors, and the checking `push_back` of SmallVector
+// against `try_push_back` of StaticVector. The checking `push_back` of SmallVector stays slower:
+// the out-of-line growth call in the loop keeps the size in memory instead of a register.
+
+namespace {
+
+using bench::Pod64;
+
+// - Containers ------------------------------------------------------------------------------------
+template <typename Element, size_t CAPACITY>
+using SmallVec = SmallVector<Element, CAPACITY>;
+
+template <typename Element, size_t CAPACITY>
+using StdVector = std::vector<Element>;
+
+template <typename Element>
+[[nodiscard]] auto make_elements(size_t count) -> std::vector<Element> {
+  std::vector<Element> res;
+  res.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    res.push_back(bench::make_element<Element>(i));
+  }
+  return res;
+}
+
+// -------------------------------------------------------------------------------------------------
+// Fills the vector up to its (inline) capacity and clears it again.
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_PushBackInline(benchmark::State& state) {
+  const auto values = make_elements<Element>(CAPACITY);
+  Container<Element, CAPACITY> vec;
+  if constexpr (requires { vec.reserve(CAPACITY); }) {
+    vec.reserve(CAPACITY);
+  }
+  for (auto _ : state) {
+    for (const auto& v : values) {
+      vec.push_back(v);
+    }
+    benchmark::DoNotOptimize(vec.data());
+    vec.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+// Appends without a capacity check, which both vectors provide as `unchecked_push_back`.
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_UncheckedPushBackInline(benchmark::State& state) {
+  const auto values = make_elements<Element>(CAPACITY);
+  Container<Element, CAPACITY> vec;
+  for (auto _ : state) {
+    for (const auto& v : values) {
+      vec.unchecked_push_back(v);
+    }
+    benchmark::DoNotOptimize(vec.data());
+    vec.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+// Appends with a capacity check: StaticVector reports a full vector, SmallVector spills.
+template <typename Element, size_t CAPACITY>
+void BM_TryPushBackInline(benchmark::State& state) {
+  const auto values = make_elements<Element>(CAPACITY);
+  StaticVector<Element, CAPACITY> vec;
+  for (auto _ : state) {
+    for (const auto& v : values) {
+      if (vec.try_push_back(v) == nullptr) { std::abort(); }
+    }
+    benchmark::DoNotOptimize(vec.data());
+    vec.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+// A fresh vector per iteration that grows to eight times the inline capacity.
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_PushBackSpill(benchmark::State& state) {
+  constexpr size_t SIZE = 8UZ * CAPACITY;
+  const auto values     = make_elements<Element>(SIZE);
+  for (auto _ : state) {
+    Container<Element, CAPACITY> vec;
+    for (const auto& v : values) {
+      vec.push_back(v);
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(SIZE));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_SMALL_VECTOR_BENCHMARKS(Element, CAPACITY)                                              \
+  BENCHMARK(BM_PushBackInline<StaticVector, Element, CAPACITY>);                                   \
+  BENCHMARK(BM_PushBackInline<SmallVec, Element, CAPACITY>);                                       \
+  BENCHMARK(BM_PushBackInline<StdVector, Element, CAPACITY>);                                      \
+  BENCHMARK(BM_UncheckedPushBackInline<StaticVector, Element, CAPACITY>);                          \
+  BENCHMARK(BM_UncheckedPushBackInline<SmallVec, Element, CAPACITY>);                              \
+  BENCHMARK(BM_TryPushBackInline<Element, CAPACITY>);                                              \
+  BENCHMARK(BM_PushBackSpill<SmallVec, Element, CAPACITY>);                                        \
+  BENCHMARK(BM_PushBackSpill<StdVector, Element, CAPACITY>)
+
+SV_SMALL_VECTOR_BENCHMARKS(int, 16UZ);
+SV_SMALL_VECTOR_BENCHMARKS(int, 256UZ);
+SV_SMALL_VECTOR_BENCHMARKS(Pod64, 16UZ);
+SV_SMALL_VECTOR_BENCHMARKS(std::string, 16UZ);
@@ -0,0 +1,167 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <tuple>
+
+#include "StaticSoAVector.hpp"
+#include "StaticVector.hpp"
+
+// Scans over one or two fields of a particle: StaticSoAVector only loads the scanned columns,
+// StaticVector of the equivalent struct loads whole particles.
+
+namespace {
+
+struct Particle {
+  double x;
+  double y;
+  double z;
+  float mass;
+  std::int32_t id;
+};
+static_assert(sizeof(Particle) == 32UZ);
+
+using ParticleRow = std::tuple<double, double, double, float, std::int32_t>;
+
+template <size_t CAPACITY>
+using AoS = StaticVector<Particle, CAPACITY>;
+
+template <size_t CAPACITY>
+using SoA = StaticSoAVector<ParticleRow, CAPACITY>;
+
+// The large vectors do not fit on the stack and exceed the L2 cache.
+template <typename Vec>
+[[nodiscard]] auto make_particles() -> std::unique_ptr<const Vec> {
+  auto vec = std::make_unique<Vec>();
+  for (size_t i = 0; i < vec->capacity(); ++i) {
+    const auto d    = static_cast<double>(i);
+    const auto mass = static_cast<float>(i % 7UZ);
+    vec->emplace_back(d, 2.0 * d, 3.0 * d, mass, static_cast<std::int32_t>(i));
+  }
+  return vec;
+}
+
+// -------------------------------------------------------------------------------------------------
+template <size_t CAPACITY>
+void BM_AoSSumX(benchmark::State& state) {
+  const auto vec = make_particles<AoS<CAPACITY>>();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& p : *vec) {
+      sum += p.x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <size_t CAPACITY>
+void BM_SoASumX(benchmark::State& state) {
+  const auto vec = make_particles<SoA<CAPACITY>>();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto x : vec->template column<0>()) {
+      sum += x;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <size_t CAPACITY>
+void BM_AoSSumId(benchmark::State& state) {
+  const auto vec = make_particles<AoS<CAPACITY>>();
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    for (const auto& p : *vec) {
+      sum += p.id;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <size_t CAPACITY>
+void BM_SoASumId(benchmark::State& state) {
+  const auto vec = make_particles<SoA<CAPACITY>>();
+  for (auto _ : state) {
+    std::int64_t sum = 0;
+    for (const auto id : vec->template column<4>()) {
+      sum += id;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+// Two fields: the momentum in x direction.
+template <size_t CAPACITY>
+void BM_AoSMomentumX(benchmark::State& state) {
+  const auto vec = make_particles<AoS<CAPACITY>>();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& p : *vec) {
+      sum += p.x * static_cast<double>(p.mass);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <size_t CAPACITY>
+void BM_SoAMomentumX(benchmark::State& state) {
+  const auto vec  = make_particles<SoA<CAPACITY>>();
+  const auto x    = vec->template column<0>();
+  const auto mass = vec->template column<3>();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+      sum += x[i] * static_cast<double>(mass[i]);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+// Whole rows through the proxy iterator.
+template <size_t CAPACITY>
+void BM_AoSIterateRows(benchmark::State& state) {
+  const auto vec = make_particles<AoS<CAPACITY>>();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& p : *vec) {
+      sum += p.x + p.y + p.z;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <size_t CAPACITY>
+void BM_SoAIterateRows(benchmark::State& state) {
+  const auto vec = make_particles<SoA<CAPACITY>>();
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (const auto& [x, y, z, mass, id] : *vec) {
+      sum += x + y + z;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_SOA_BENCHMARKS(CAPACITY)                                                                \
+  BENCHMARK(BM_AoSSumX<CAPACITY>);                                                                 \
+  BENCHMARK(BM_SoASumX<CAPACITY>);                                                                 \
+  BENCHMARK(BM_AoSSumId<CAPACITY>);                                                              \
+  BENCHMARK(BM_SoASumId<CAPACITY>);                                                              \
+  BENCHMARK(BM_AoSMomentumX<CAPACITY>);                                                            \
+  BENCHMARK(BM_SoAMomentumX<CAPACITY>);                                                            \
+  BENCHMARK(BM_AoSIterateRows<CAPACITY>);                                                          \
+  BENCHMARK(BM_SoAIterateRows<CAPACITY>)
+
+SV_SOA_BENCHMARKS(1024UZ);
+SV_SOA_BENCHMARKS(262144UZ);
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+
+#include "Algorithm.hpp"
+#include "StaticVector.hpp"
+
+// Sorting a StaticVector of every size from 1 to 64 with `sort`, which uses sorting networks for
+// small sizes, against `std::sort`. Every iteration sorts a fresh copy of one of several random
+// inputs, such that the branch predictor cannot learn the order.
+
+namespace {
+
+constexpr size_t CAPACITY = 64UZ;
+constexpr size_t INPUTS   = 64UZ;
+
+enum class Algo : std::uint8_t { NETWORK, STD };
+
+template <typename Element>
+using Vec = StaticVector<Element, CAPACITY>;
+
+template <typename Element>
+[[nodiscard]] auto make_inputs(size_t size) -> std::array<Vec<Element>, INPUTS> {
+  std::mt19937 rng(42);  // NOLINT
+  std::uniform_int_distribution<std::int32_t> dist(-1000, 1000);
+  std::array<Vec<Element>, INPUTS> inputs;
+  for (auto& input : inputs) {
+    for (size_t i = 0; i < size; ++i) {
+      input.push_back(static_cast<Element>(dist(rng)));
+    }
+  }
+  return inputs;
+}
+
+// -------------------------------------------------------------------------------------------------
+template <typename Element, Algo ALGO>
+void BM_Sort(benchmark::State& state) {
+  const auto size   = static_cast<size_t>(state.range(0));
+  const auto inputs = make_inputs<Element>(size);
+
+  size_t i = 0UZ;
+  for (auto _ : state) {
+    auto vec = inputs[i++ % INPUTS];
+    if constexpr (ALGO == Algo::NETWORK) {
+      sort(vec);
+    } else {
+      std::sort(vec.begin(), vec.end());
+    }
+    benchmark::DoNotOptimize(vec.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+#define SV_SORT_BENCHMARKS(Element)                                                                \
+  BENCHMARK(BM_Sort<Element, Algo::NETWORK>)->DenseRange(1, CAPACITY);                             \
+  BENCHMARK(BM_Sort<Element, Algo::STD>)->DenseRange(1, CAPACITY)
+
+SV_SORT_BENCHMARKS(std::int32_t);
+SV_SORT_BENCHMARKS(float);
+SV_SORT_BENCHMARKS(std::uint64_t);
+SV_SORT_BENCHMARKS(double);
@@ -0,0 +1,215 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef SV_HAVE_BOOST
+#include <boost/container/static_vector.hpp>
+#endif  // SV_HAVE_BOOST
+
+#include "Common.hpp"
+#include "StaticVector.hpp"
+
+// Compares StaticVector against std::vector (with reserved capacity), std::array (where the
+// operation makes sense for a fixed size) and boost::container::static_vector (if available).
+
+namespace {
+
+using bench::Pod64;
+
+// - Containers ------------------------------------------------------------------------------------
+template <typename Element, size_t CAPACITY>
+using StdVector = std::vector<Element>;
+
+template <typename Element, size_t CAPACITY>
+using StdArray = std::array<Element, CAPACITY>;
+
+#ifdef SV_HAVE_BOOST
+template <typename Element, size_t CAPACITY>
+using BoostStaticVector = boost::container::static_vector<Element, CAPACITY>;
+#endif  // SV_HAVE_BOOST
+
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+[[nodiscard]] auto make_full() -> Container<Element, CAPACITY> {
+  if constexpr (std::is_same_v<Container<Element, CAPACITY>, StdArray<Element, CAPACITY>>) {
+    Container<Element, CAPACITY> res;
+    for (size_t i = 0; i < CAPACITY; ++i) {
+      res[i] = bench::make_element<Element>(i);
+    }
+    return res;
+  } else {
+    return bench::make_vector<Container<Element, CAPACITY>>(CAPACITY);
+  }
+}
+
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+[[nodiscard]] auto make_empty() -> Container<Element, CAPACITY> {
+  Container<Element, CAPACITY> res;
+  if constexpr (requires { res.reserve(CAPACITY); }) {
+    res.reserve(CAPACITY);
+  }
+  return res;
+}
+
+template <typename Element>
+[[nodiscard]] auto make_elements(size_t count) -> std::vector<Element> {
+  std::vector<Element> res;
+  res.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    res.push_back(bench::make_element<Element>(i));
+  }
+  return res;
+}
+
+// - push_back / emplace_back ----------------------------------------------------------------------
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_PushBack(benchmark::State& state) {
+  const auto values = make_elements<Element>(CAPACITY);
+  auto vec          = make_empty<Container, Element, CAPACITY>();
+  for (auto _ : state) {
+    for (const auto& v : values) {
+      vec.push_back(v);
+    }
+    benchmark::DoNotOptimize(vec.data());
+    vec.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_EmplaceBack(benchmark::State& state) {
+  auto vec = make_empty<Container, Element, CAPACITY>();
+  for (auto _ : state) {
+    for (size_t i = 0; i < CAPACITY; ++i) {
+      if constexpr (std::is_same_v<Element, std::string>) {
+        vec.emplace_back(64UZ, static_cast<char>('a' + i % 26UZ));
+      } else if constexpr (std::is_same_v<Element, Pod64>) {
+        vec.emplace_back(Pod64{{i, i, i, i, i, i, i, i}});
+      } else {
+        vec.emplace_back(static_cast<Element>(i));
+      }
+    }
+    benchmark::DoNotOptimize(vec.data());
+    vec.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+// - copy / move -----------------------------------------------------------------------------------
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_Copy(benchmark::State& state) {
+  const auto src = make_full<Container, Element, CAPACITY>();
+  for (auto _ : state) {
+    auto dst = src;
+    benchmark::DoNotOptimize(dst.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_Move(benchmark::State& state) {
+  auto src = make_full<Container, Element, CAPACITY>();
+  for (auto _ : state) {
+    auto dst = std::move(src);
+    benchmark::DoNotOptimize(dst.data());
+    src = std::move(dst);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+// - iteration -------------------------------------------------------------------------------------
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_IterateForward(benchmark::State& state) {
+  const auto vec = make_full<Container, Element, CAPACITY>();
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (auto it = vec.begin(); it != vec.end(); ++it) {
+      sum += bench::weight(*it);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_IterateReverse(benchmark::State& state) {
+  const auto vec = make_full<Container, Element, CAPACITY>();
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (auto it = vec.rbegin(); it != vec.rend(); ++it) {
+      sum += bench::weight(*it);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+// - pop_back / clear ------------------------------------------------------------------------------
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_PopBack(benchmark::State& state) {
+  const auto full = make_full<Container, Element, CAPACITY>();
+  auto vec        = make_empty<Container, Element, CAPACITY>();
+  for (auto _ : state) {
+    state.PauseTiming();
+    vec = full;
+    state.ResumeTiming();
+    while (!vec.empty()) {
+      vec.pop_back();
+    }
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+template <template <typename, size_t> typename Container, typename Element, size_t CAPACITY>
+void BM_Clear(benchmark::State& state) {
+  const auto full = make_full<Container, Element, CAPACITY>();
+  auto vec        = make_empty<Container, Element, CAPACITY>();
+  for (auto _ : state) {
+    state.PauseTiming();
+    vec = full;
+    state.ResumeTiming();
+    vec.clear();
+    benchmark::DoNotOptimize(vec.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(CAPACITY));
+}
+
+}  // namespace
+
+// - Registration ----------------------------------------------------------------------------------
+#define SV_BENCHMARK_FIXED(Container, Element, CAPACITY)                                           \
+  BENCHMARK(BM_Copy<Container, Element, CAPACITY>);                                                \
+  BENCHMARK(BM_Move<Container, Element, CAPACITY>);                                                \
+  BENCHMARK(BM_IterateForward<Container, Element, CAPACITY>);                                      \
+  BENCHMARK(BM_IterateReverse<Container, Element, CAPACITY>)
+
+#define SV_BENCHMARK_DYNAMIC(Container, Element, CAPACITY)                                         \
+  SV_BENCHMARK_FIXED(Container, Element, CAPACITY);                                                \
+  BENCHMARK(BM_PushBack<Container, Element, CAPACITY>);                                            \
+  BENCHMARK(BM_EmplaceBack<Container, Element, CAPACITY>);                                         \
+  BENCHMARK(BM_PopBack<Container, Element, CAPACITY>);                                             \
+  BENCHMARK(BM_Clear<Container, Element, CAPACITY>)
+
+#ifdef SV_HAVE_BOOST
+#define SV_BENCHMARK_BOOST(Element, CAPACITY)                                                      \
+  SV_BENCHMARK_DYNAMIC(BoostStaticVector, Element, CAPACITY)
+#else
+#define SV_BENCHMARK_BOOST(Element, CAPACITY) static_assert(true)
+#endif  // SV_HAVE_BOOST
+
+#define SV_BENCHMARK_ALL(Element, CAPACITY)                                                        \
+  SV_BENCHMARK_DYNAMIC(StaticVector, Element, CAPACITY);                                           \
+  SV_BENCHMARK_DYNAMIC(StdVector, Element, CAPACITY);                                              \
+  SV_BENCHMARK_BOOST(Element, CAPACITY);                                                           \
+  SV_BENCHMARK_FIXED(StdArray, Element, CAPACITY)
+
+SV_BENCHMARK_ALL(int, 16UZ);
+SV_BENCHMARK_ALL(int, 256UZ);
+SV_BENCHMARK_ALL(int, 4096UZ);
+SV_BENCHMARK_ALL(std::string, 16UZ);
+SV_BENCHMARK_ALL(std::string, 256UZ);
+SV_BENCHMARK_ALL(Pod64, 16UZ);
+SV_BENCHMARK_ALL(Pod64, 256UZ);
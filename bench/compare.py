@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Compares Google Benchmark JSON results against a stored baseline.
+
+Both arguments are either a single JSON file or a directory of JSON files as written by the
+`bench_save` target. Benchmarks are matched by name; for repeated runs the median aggregate is used.
+Exits with status 1 if any benchmark is slower than the baseline by more than the threshold.
+"""
+
+import argparse
+import json
+import pathlib
+import sys
+
+
+def load_results(path: pathlib.Path) -> dict[str, float]:
+    files = sorted(path.glob("*.json")) if path.is_dir() else [path]
+    if not files:
+        raise SystemExit(f"No benchmark results found in '{path}'.")
+
+    results: dict[str, float] = {}
+    for file in files:
+        with file.open() as f:
+            data = json.load(f)
+
+        medians = {}
+        singles = {}
+        for bench in data["benchmarks"]:
+            if bench.get("error_occurred", False):
+                continue
+            if bench.get("run_type") == "aggregate":
+                if bench.get("aggregate_name") == "median":
+                    medians[bench["run_name"]] = bench["cpu_time"]
+            else:
+                singles.setdefault(bench.get("run_name", bench["name"]), bench["cpu_time"])
+
+        results.update(singles)
+        results.update(medians)
+    return results
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", type=pathlib.Path, help="baseline JSON file or directory")
+    parser.add_argument("contender", type=pathlib.Path, help="current JSON file or directory")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="relative slowdown that counts as regression (default: %(default)s)",
+    )
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    contender = load_results(args.contender)
+
+    common = [name for name in contender if name in baseline]
+    if not common:
+        print("No common benchmarks between baseline and contender.")
+        return 1
+
+    width = max(len(name) for name in common)
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Contender':>12}  {'Change':>8}")
+    regressions = []
+    for name in common:
+        old, new = baseline[name], contender[name]
+        change = (new - old) / old if old > 0.0 else 0.0
+        marker = ""
+        if change > args.threshold:
+            regressions.append(name)
+            marker = "  <-- regression"
+        print(f"{name:<{width}}  {old:>12.2f}  {new:>12.2f}  {change:>+7.1%}{marker}")
+
+    for name in sorted(set(baseline) - set(contender)):
+        print(f"{name:<{width}}  missing in contender")
+    for name in sorted(set(contender) - set(baseline)):
+        print(f"{name:<{width}}  missing in baseline")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) regressed by more than {args.threshold:.1%}.")
+        return 1
+    print(f"\nNo regressions above {args.threshold:.1%}.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,270 @@
+#ifndef ALGORITHM_HPP_
+#define ALGORITHM_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "Simd.hpp"
+#include "SortingNetwork.hpp"
+#include "StaticVector.hpp"
+
+// -------------------------------------------------------------------------------------------------
+// Predicate `element OP value`. Passed to `find_if` or `count_if` with one of the standard
+// comparison function objects and a value of the element type, the search is vectorized.
+template <typename Op, typename Value>
+struct ComparePredicate {
+  using op_type = Op;
+  Value value;
+
+  template <typename Element>
+  [[nodiscard]] constexpr auto operator()(const Element& element) const noexcept -> bool {
+    return Op{}(element, value);
+  }
+};
+
+template <typename Op, typename Value>
+[[nodiscard]] constexpr auto compare_with(Value value) noexcept -> ComparePredicate<Op, Value> {
+  return ComparePredicate<Op, Value>{value};
+}
+
+namespace detail {
+
+// -------------------------------------------------------------------------------------------------
+// Kernel for the comparison `Op` on elements of type `Element`. Function objects for another type
+// than `Element` would convert the operands first, those are left to the scalar algorithms.
+template <typename Op, typename Element>
+struct simd_compare {};
+
+template <typename T, typename Element>
+concept OperandOf = std::is_void_v<T> || std::is_same_v<T, Element>;
+
+template <simd::Compare CMP>
+using CompareConstant = std::integral_constant<simd::Compare, CMP>;
+
+template <typename Element, OperandOf<Element> T>
+struct simd_compare<std::equal_to<T>, Element> : CompareConstant<simd::Compare::EQ> {};
+template <typename Element, OperandOf<Element> T>
+struct simd_compare<std::not_equal_to<T>, Element> : CompareConstant<simd::Compare::NE> {};
+template <typename Element, OperandOf<Element> T>
+struct simd_compare<std::less<T>, Element> : CompareConstant<simd::Compare::LT> {};
+template <typename Element, OperandOf<Element> T>
+struct simd_compare<std::less_equal<T>, Element> : CompareConstant<simd::Compare::LE> {};
+template <typename Element, OperandOf<Element> T>
+struct simd_compare<std::greater<T>, Element> : CompareConstant<simd::Compare::GT> {};
+template <typename Element, OperandOf<Element> T>
+struct simd_compare<std::greater_equal<T>, Element> : CompareConstant<simd::Compare::GE> {};
+
+template <typename Pred, typename Element>
+inline constexpr bool is_simd_predicate_v = false;
+
+template <typename Op, typename Element>
+  requires(simd::Vectorizable<Element> && requires { simd_compare<Op, Element>::value; })
+inline constexpr bool is_simd_predicate_v<ComparePredicate<Op, Element>, Element> = true;
+
+// Arithmetic elements ordered ascending by `<` or descending by `>`.
+template <typename Op, typename Element>
+concept ArithmeticOrdering =
+    std::is_arithmetic_v<Element> && !std::is_same_v<Element, bool> &&
+    requires { simd_compare<Op, Element>::value; } &&
+    (simd_compare<Op, Element>::value == simd::Compare::LT ||
+     simd_compare<Op, Element>::value == simd::Compare::GT);
+
+// -------------------------------------------------------------------------------------------------
+// Vectors of at most this many elements are sorted with a sorting network. Integers compare and
+// exchange with a min and a max, floating-point numbers need a compare and two blends, which moves
+// the break-even point with `std::sort` to smaller sizes.
+template <typename Element>
+inline constexpr size_t MAX_NETWORK_SORT_SIZE = std::is_integral_v<Element> ? 32UZ : 16UZ;
+
+// Vectors of at most this many elements are sorted stably by insertion.
+inline constexpr size_t MAX_INSERTION_SORT_SIZE = 16UZ;
+
+// Sorting networks for every size up to MAX_N, indexed by the size. Dispatching on the size is a
+// single indirect call, and every network is instantiated once per element type and predicate.
+template <typename Element, typename Compare, size_t MAX_N>
+inline constexpr auto NETWORKS = []<size_t... Ns>(std::index_sequence<Ns...> /*sizes*/) {
+  return std::array{&network::sort<Ns, Element, Compare>...};
+}(std::make_index_sequence<MAX_N + 1UZ>{});
+
+template <size_t CAPACITY, typename Element, typename Compare>
+constexpr void network_sort(Element* data, size_t size, Compare& comp) noexcept {
+  constexpr auto MAX_N = std::min(CAPACITY, MAX_NETWORK_SORT_SIZE<Element>);
+  assert(size <= MAX_N && "Size must not exceed the largest network.");
+  NETWORKS<Element, Compare, MAX_N>[size](data, comp);
+}
+
+template <typename Element, typename Compare>
+constexpr void insertion_sort(Element* first, Element* last, Compare& comp) noexcept {
+  for (auto* it = first; it != last; ++it) {
+    Element e(std::move(*it));
+    auto* pos = it;
+    for (; pos != first && comp(e, *(pos - 1)); --pos) {
+      *pos = std::move(*(pos - 1));
+    }
+    *pos = std::move(e);
+  }
+}
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Linear searches over a StaticVector. For arithmetic elements compared with `==`, `!=`, `<`, `<=`,
+// `>` or `>=` the vector is scanned one register at a time; the chunks never reach past the
+// capacity, so a small vector is scanned without a loop. Any other element type or predicate uses
+// the scalar algorithms from <algorithm>.
+template <typename Element, size_t CAPACITY, typename Alignment, typename Pred>
+[[nodiscard]] constexpr auto find_if(const StaticVector<Element, CAPACITY, Alignment>& vec,
+                                     const Pred& pred) noexcept -> const Element* {
+  if constexpr (detail::is_simd_predicate_v<Pred, Element>) {
+    if !consteval {
+      constexpr auto CMP = detail::simd_compare<typename Pred::op_type, Element>::value;
+      return vec.data() +
+             detail::simd::find_first<CMP, Element, CAPACITY>(vec.data(), vec.size(), pred.value);
+    }
+  }
+  return std::find_if(vec.begin(), vec.end(), pred);
+}
+
+template <typename Element, size_t CAPACITY, typename Alignment, typename Pred>
+[[nodiscard]] constexpr auto find_if(StaticVector<Element, CAPACITY, Alignment>& vec,
+                                     const Pred& pred) noexcept -> Element* {
+  const auto& cvec = vec;
+  return vec.begin() + (find_if(cvec, pred) - cvec.begin());
+}
+
+template <typename Element, size_t CAPACITY, typename Alignment, typename Pred>
+[[nodiscard]] constexpr auto count_if(const StaticVector<Element, CAPACITY, Alignment>& vec,
+                                      const Pred& pred) noexcept -> size_t {
+  if constexpr (detail::is_simd_predicate_v<Pred, Element>) {
+    if !consteval {
+      constexpr auto CMP = detail::simd_compare<typename Pred::op_type, Element>::value;
+      return detail::simd::count<CMP, Element, CAPACITY>(vec.data(), vec.size(), pred.value);
+    }
+  }
+  return static_cast<size_t>(std::count_if(vec.begin(), vec.end(), pred));
+}
+
+// -------------------------------------------------------------------------------------------------
+template <typename Element, size_t CAPACITY, typename Alignment>
+[[nodiscard]] constexpr auto find(const StaticVector<Element, CAPACITY, Alignment>& vec,
+                                  const std::type_identity_t<Element>& value) noexcept
+    -> const Element* {
+  if constexpr (detail::simd::Vectorizable<Element>) {
+    return find_if(vec, compare_with<std::equal_to<>>(value));
+  } else {
+    return std::find(vec.begin(), vec.end(), value);
+  }
+}
+
+template <typename Element, size_t CAPACITY, typename Alignment>
+[[nodiscard]] constexpr auto find(StaticVector<Element, CAPACITY, Alignment>& vec,
+                                  const std::type_identity_t<Element>& value) noexcept -> Element* {
+  const auto& cvec = vec;
+  return vec.begin() + (find(cvec, value) - cvec.begin());
+}
+
+template <typename Element, size_t CAPACITY, typename Alignment>
+[[nodiscard]] constexpr auto count(const StaticVector<Element, CAPACITY, Alignment>& vec,
+                                   const std::type_identity_t<Element>& value) noexcept -> size_t {
+  if constexpr (detail::simd::Vectorizable<Element>) {
+    return count_if(vec, compare_with<std::equal_to<>>(value));
+  } else {
+    return static_cast<size_t>(std::count(vec.begin(), vec.end(), value));
+  }
+}
+
+template <typename Element, size_t CAPACITY, typename Alignment>
+[[nodiscard]] constexpr auto contains(const StaticVector<Element, CAPACITY, Alignment>& vec,
+                                      const std::type_identity_t<Element>& value) noexcept -> bool {
+  return find(vec, value) != vec.end();
+}
+
+// -------------------------------------------------------------------------------------------------
+// Erases every element that satisfies `pred` and keeps the order of the others, returns the number
+// of erased elements. For arithmetic elements compared with `==`, `!=`, `<`, `<=`, `>` or `>=` the
+// kept elements are packed one register at a time; other predicates on arithmetic elements copy
+// every element and advance the write position by the negated predicate, without a branch that
+// mispredicts at mixed keep ratios. Any other element type uses `std::remove_if`.
+template <typename Element, size_t CAPACITY, typename Alignment, typename Pred>
+constexpr auto erase_if(StaticVector<Element, CAPACITY, Alignment>& vec, Pred pred) noexcept
+    -> size_t {
+  const auto old_size = vec.size();
+  auto* first         = vec.begin();
+  if constexpr (detail::is_simd_predicate_v<Pred, Element>) {
+    if !consteval {
+      constexpr auto CMP = detail::simd_compare<typename Pred::op_type, Element>::value;
+      vec.erase(first + detail::simd::remove<CMP, Element, CAPACITY>(first, old_size, pred.value),
+                vec.end());
+      return old_size - vec.size();
+    }
+  }
+  if constexpr (std::is_arithmetic_v<Element>) {
+    size_t kept = 0UZ;
+    for (size_t i = 0; i < old_size; ++i) {
+      const Element e  = first[i];
+      first[kept]      = e;
+      kept            += static_cast<size_t>(!pred(e));
+    }
+    vec.erase(first + kept, vec.end());
+  } else {
+    vec.erase(std::remove_if(first, vec.end(), pred), vec.end());
+  }
+  return old_size - vec.size();
+}
+
+// Erases every element equal to `value`, see `erase_if`.
+template <typename Element, size_t CAPACITY, typename Alignment>
+constexpr auto erase(StaticVector<Element, CAPACITY, Alignment>& vec,
+                     const std::type_identity_t<Element>& value) noexcept -> size_t {
+  if constexpr (detail::simd::Vectorizable<Element>) {
+    return erase_if(vec, compare_with<std::equal_to<>>(value));
+  } else {
+    return erase_if(vec, [&value](const Element& e) { return e == value; });
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Sorts the vector by `comp`. Arithmetic elements ordered by `<` or `>` are sorted with the sorting
+// network for the size of the vector, a fixed sequence of branchless compare-exchanges, where
+// `std::sort` mispredicts about every other comparison. Any other element type or predicate and
+// larger vectors use `std::sort`.
+template <typename Element, size_t CAPACITY, typename Alignment, typename Compare = std::less<>>
+constexpr void sort(StaticVector<Element, CAPACITY, Alignment>& vec, Compare comp = {}) noexcept {
+  if constexpr (detail::ArithmeticOrdering<Compare, Element>) {
+    if (vec.size() <= detail::MAX_NETWORK_SORT_SIZE<Element>) {
+      detail::network_sort<CAPACITY>(vec.data(), vec.size(), comp);
+      return;
+    }
+  }
+  std::sort(vec.begin(), vec.end(), comp);
+}
+
+// Sorts the vector by `comp` and keeps equivalent elements in order. Equivalent integers are equal,
+// so they are sorted by the network like `sort`. Other small vectors are sorted by insertion, large
+// ones by `std::stable_sort`, which may allocate a buffer.
+template <typename Element, size_t CAPACITY, typename Alignment, typename Compare = std::less<>>
+constexpr void stable_sort(StaticVector<Element, CAPACITY, Alignment>& vec,
+                           Compare comp = {}) noexcept {
+  if constexpr (std::is_integral_v<Element> && detail::ArithmeticOrdering<Compare, Element>) {
+    if (vec.size() <= detail::MAX_NETWORK_SORT_SIZE<Element>) {
+      detail::network_sort<CAPACITY>(vec.data(), vec.size(), comp);
+      return;
+    }
+  }
+  if consteval {
+    detail::insertion_sort(vec.begin(), vec.end(), comp);
+  } else {
+    if (vec.size() <= detail::MAX_INSERTION_SORT_SIZE) {
+      detail::insertion_sort(vec.begin(), vec.end(), comp);
+    } else {
+      std::stable_sort(vec.begin(), vec.end(), comp);
+    }
+  }
+}
+
+#endif  // ALGORITHM_HPP_
@@ -0,0 +1,41 @@
+#ifndef ALIGNMENT_HPP_
+#define ALIGNMENT_HPP_
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+#include "Simd.hpp"
+
+// -------------------------------------------------------------------------------------------------
+// Alignment policies for the storage of UninitializedArray and StaticVector. The storage is aligned
+// to `ALIGNMENT`, or to the alignment of the element if that is stricter. As the alignment of the
+// storage carries over to the vector, its size is rounded up to a multiple of the alignment too.
+template <size_t ALIGNMENT>
+struct AlignedTo {
+  static_assert(std::has_single_bit(ALIGNMENT), "Alignment must be a power of two.");
+
+  template <typename Element>
+  static constexpr size_t alignment = std::max(ALIGNMENT, alignof(Element));
+
+  // The alignment the policy asks for by itself, for vectors that store no element.
+  static constexpr size_t minimum_alignment = ALIGNMENT;
+};
+
+// Size of a cache line; the constant from <new> is not stable across compiler flags.
+inline constexpr size_t CACHE_LINE_SIZE = 64UZ;
+
+// Width of the vector registers the kernels in Simd.hpp use, at least the width of an SSE register.
+inline constexpr size_t SIMD_WIDTH = std::max(detail::simd::REGISTER_BYTES, 16UZ);
+
+// Only the alignment the element requires (default).
+using ElementAligned = AlignedTo<1UZ>;
+
+// The data is aligned to the SIMD width, such that aligned vector loads are valid.
+using SimdAligned = AlignedTo<SIMD_WIDTH>;
+
+// The vector starts at a cache line boundary and occupies whole cache lines, so that vectors owned
+// by different threads never share a cache line.
+using CacheLineIsolated = AlignedTo<CACHE_LINE_SIZE>;
+
+#endif  // ALIGNMENT_HPP_
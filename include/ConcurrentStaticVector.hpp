@@ -0,0 +1,150 @@
+#ifndef CONCURRENT_STATIC_VECTOR_HPP_
+#define CONCURRENT_STATIC_VECTOR_HPP_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+#include "Alignment.hpp"
+#include "UninitializedArray.hpp"
+
+// -------------------------------------------------------------------------------------------------
+// Fixed-capacity vector that many threads can append to at the same time without a lock. A writer
+// reserves a slot with a single `fetch_add` on the size, constructs its element in place and then
+// publishes the slot by setting the slot's flag with release semantics.
+//
+// Appending is the only concurrent operation. Once all writers are done and that is synchronized
+// with the reader, e.g. by joining the threads, `view()` returns the elements as a plain span. While
+// writers are still active, `published()` returns the elements that are visible so far.
+template <typename Element, size_t CAPACITY>
+class ConcurrentStaticVector {
+  static_assert(CAPACITY > 0UZ, "ConcurrentStaticVector requires a capacity greater than zero.");
+
+  detail::UninitializedArray<Element, CAPACITY> m_storage;
+  std::array<std::atomic<bool>, CAPACITY> m_published{};
+
+  // Number of reserved slots. Writers that find the vector full still increment it, so it may
+  // exceed `CAPACITY`. It lives on its own cache line, as every writer modifies it.
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_reserved = 0UZ;
+
+ public:
+  using value_type      = Element;
+  using size_type       = size_t;
+  using difference_type = ssize_t;
+  using reference       = value_type&;
+  using const_reference = const value_type&;
+  using pointer         = value_type*;
+  using const_pointer   = const value_type*;
+
+  ConcurrentStaticVector() noexcept = default;
+
+  // The slots are shared between threads, copying or moving them is not.
+  ConcurrentStaticVector(const ConcurrentStaticVector&)                    = delete;
+  ConcurrentStaticVector(ConcurrentStaticVector&&)                         = delete;
+  auto operator=(const ConcurrentStaticVector&) -> ConcurrentStaticVector& = delete;
+  auto operator=(ConcurrentStaticVector&&) -> ConcurrentStaticVector&      = delete;
+
+  ~ConcurrentStaticVector() noexcept { clear(); }
+
+  // -----------------------------------------------------------------------------------------------
+  // Thread-safe. Returns a pointer to the new element, or null if the vector is full.
+  auto try_push_back(const Element& e) noexcept -> pointer { return try_emplace_back(e); }
+  auto try_push_back(Element&& e) noexcept -> pointer { return try_emplace_back(std::move(e)); }
+
+  template <typename... Args>
+  auto try_emplace_back(Args&&... args) noexcept -> pointer {
+    const auto idx = m_reserved.fetch_add(1UZ, std::memory_order_relaxed);
+    if (idx >= CAPACITY) [[unlikely]] { return nullptr; }
+
+    Element* e = std::construct_at(m_storage.data() + idx, std::forward<Args>(args)...);
+    m_published[idx].store(true, std::memory_order_release);
+    return e;
+  }
+
+  // Thread-safe. Reserves the slots for all of `values` with a single `fetch_add`, which is cheaper
+  // than appending them one by one. Appends the leading elements that fit and returns their number.
+  auto try_append(const Element* values, size_type count) noexcept -> size_type {
+    const auto first = m_reserved.fetch_add(count, std::memory_order_relaxed);
+    if (first >= CAPACITY) [[unlikely]] { return 0UZ; }
+
+    const auto fitting = std::min(count, CAPACITY - first);
+    std::uninitialized_copy_n(values, fitting, m_storage.data() + first);
+    for (size_type i = 0; i < fitting; ++i) {
+      m_published[first + i].store(true, std::memory_order_release);
+    }
+    return fitting;
+  }
+
+  // Thread-safe. The vector must not be full.
+  void push_back(const Element& e) noexcept { emplace_back(e); }
+  void push_back(Element&& e) noexcept { emplace_back(std::move(e)); }
+
+  template <typename... Args>
+  void emplace_back(Args&&... args) noexcept {
+    [[maybe_unused]] const auto* e = try_emplace_back(std::forward<Args>(args)...);
+    assert(e != nullptr && "Size may not exceed capacity.");
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Thread-safe. The number of reserved slots, including those that are not published yet.
+  [[nodiscard]] auto size() const noexcept -> size_type {
+    return std::min(m_reserved.load(std::memory_order_relaxed), CAPACITY);
+  }
+  [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0UZ; }
+  [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return CAPACITY; }
+  [[nodiscard]] static constexpr auto max_size() noexcept -> size_type { return CAPACITY; }
+
+  // Thread-safe. Whether the element in slot `idx` is constructed and visible to this thread.
+  [[nodiscard]] auto is_published(size_type idx) const noexcept -> bool {
+    assert(idx < CAPACITY && "Index must be less than CAPACITY.");
+    return m_published[idx].load(std::memory_order_acquire);
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Thread-safe. The leading elements that are published, up to the first slot that is reserved
+  // but not yet published. Costs one acquire load per element.
+  [[nodiscard]] auto published() const noexcept -> std::span<const Element> {
+    const auto reserved = size();
+    size_type count     = 0UZ;
+    while (count < reserved && is_published(count)) {
+      ++count;
+    }
+    return std::span<const Element>{m_storage.data(), count};
+  }
+
+  // All elements. All writers must be done and synchronized with the calling thread.
+  [[nodiscard]] auto view() noexcept -> std::span<Element> {
+    assert(all_published() && "Writers must be done before viewing the elements.");
+    return std::span<Element>{m_storage.data(), size()};
+  }
+  [[nodiscard]] auto view() const noexcept -> std::span<const Element> {
+    assert(all_published() && "Writers must be done before viewing the elements.");
+    return std::span<const Element>{m_storage.data(), size()};
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Not thread-safe. Destroys all elements and makes the slots available again.
+  void clear() noexcept {
+    assert(all_published() && "Writers must be done before clearing the vector.");
+    const auto count = size();
+    if constexpr (!std::is_trivially_destructible_v<Element>) {
+      std::destroy_n(m_storage.data(), count);
+    }
+    for (size_type i = 0; i < count; ++i) {
+      m_published[i].store(false, std::memory_order_relaxed);
+    }
+    m_reserved.store(0UZ, std::memory_order_relaxed);
+  }
+
+ private:
+  [[nodiscard]] auto all_published() const noexcept -> bool {
+    return published().size() == size();
+  }
+};
+
+#endif  // CONCURRENT_STATIC_VECTOR_HPP_
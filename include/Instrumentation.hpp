@@ -0,0 +1,210 @@
+#ifndef INSTRUMENTATION_HPP_
+#define INSTRUMENTATION_HPP_
+
+#include <cstddef>
+
+// -------------------------------------------------------------------------------------------------
+// Opt-in statistics about how full the StaticVectors of every instantiation get, to size CAPACITY
+// from measured data instead of guesses. Defining SV_INSTRUMENTATION (the CMake option of the same
+// name) records for every combination of element type and capacity:
+//
+//   - the high-water mark of the size over all vectors,
+//   - the number of pushes and pops and a histogram of the sizes they leave behind,
+//   - near-full events, where a vector grows to at least 7/8 of its capacity, and overflows, where
+//     it would grow beyond its capacity or `try_push_back` fails.
+//
+// The counters are shared by all threads and updated with relaxed atomics. Without the macro every
+// hook is an empty function and no statistics exist at all. The macro must be defined the same way
+// in every translation unit of a program.
+#ifdef SV_INSTRUMENTATION
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace detail::instrument {
+
+inline constexpr size_t HISTOGRAM_BUCKETS = 8UZ;
+
+// Name of `T` as the compiler spells it in the signature of this function.
+template <typename T>
+[[nodiscard]] consteval auto type_name() noexcept -> std::string_view {
+  const std::string_view signature = __PRETTY_FUNCTION__;
+  const auto first                 = signature.find("T = ") + 4UZ;
+  const auto last                  = std::min(signature.find("; ", first), signature.size() - 1UZ);
+  return signature.substr(first, last - first);
+}
+
+// Statistics of one instantiation. All instances are linked into a list on first use.
+struct CapacityStats {
+  std::string_view element;
+  size_t element_size;
+  size_t capacity;
+
+  std::atomic<size_t> high_water_mark = 0UZ;
+  std::atomic<size_t> pushes          = 0UZ;
+  std::atomic<size_t> pops            = 0UZ;
+  std::atomic<size_t> near_full       = 0UZ;
+  std::atomic<size_t> overflows       = 0UZ;
+  std::array<std::atomic<size_t>, HISTOGRAM_BUCKETS> size_histogram{};
+
+  CapacityStats* next = nullptr;
+};
+
+inline std::atomic<CapacityStats*> registry = nullptr;
+
+template <typename Element, size_t CAPACITY>
+[[nodiscard]] auto stats() noexcept -> CapacityStats& {
+  static CapacityStats* const instance = [] {
+    auto* s = new CapacityStats{
+        .element = type_name<Element>(), .element_size = sizeof(Element), .capacity = CAPACITY};
+    s->next = registry.load(std::memory_order_relaxed);
+    while (!registry.compare_exchange_weak(s->next, s, std::memory_order_release)) {}
+    return s;
+  }();
+  return *instance;
+}
+
+template <size_t CAPACITY>
+[[nodiscard]] constexpr auto histogram_bucket(size_t size) noexcept -> size_t {
+  return std::min(size * HISTOGRAM_BUCKETS / CAPACITY, HISTOGRAM_BUCKETS - 1UZ);
+}
+
+// Accounts for a vector that is about to grow to `new_size`.
+template <size_t CAPACITY>
+void record_size(CapacityStats& s, size_t new_size) noexcept {
+  if (new_size > CAPACITY) {
+    s.overflows.fetch_add(1UZ, std::memory_order_relaxed);
+    return;
+  }
+  if (new_size >= CAPACITY - (CAPACITY / 8UZ)) {
+    s.near_full.fetch_add(1UZ, std::memory_order_relaxed);
+  }
+  auto hwm = s.high_water_mark.load(std::memory_order_relaxed);
+  while (new_size > hwm &&
+         !s.high_water_mark.compare_exchange_weak(hwm, new_size, std::memory_order_relaxed)) {}
+}
+
+// -------------------------------------------------------------------------------------------------
+// Hooks of StaticVector, called before the size changes. They do nothing in constant evaluation.
+template <typename Element, size_t CAPACITY>
+constexpr void on_push(size_t size) noexcept {
+  if !consteval {
+    auto& s = stats<Element, CAPACITY>();
+    s.pushes.fetch_add(1UZ, std::memory_order_relaxed);
+    s.size_histogram[histogram_bucket<CAPACITY>(size + 1UZ)].fetch_add(1UZ,
+                                                                         std::memory_order_relaxed);
+    record_size<CAPACITY>(s, size + 1UZ);
+  }
+}
+
+template <typename Element, size_t CAPACITY>
+constexpr void on_pop(size_t size) noexcept {
+  if !consteval {
+    auto& s = stats<Element, CAPACITY>();
+    s.pops.fetch_add(1UZ, std::memory_order_relaxed);
+    s.size_histogram[histogram_bucket<CAPACITY>(size - 1UZ)].fetch_add(1UZ,
+                                                                         std::memory_order_relaxed);
+  }
+}
+
+template <typename Element, size_t CAPACITY>
+constexpr void on_resize(size_t new_size) noexcept {
+  if !consteval { record_size<CAPACITY>(stats<Element, CAPACITY>(), new_size); }
+}
+
+template <typename Element, size_t CAPACITY>
+constexpr void on_overflow() noexcept {
+  if !consteval { stats<Element, CAPACITY>().overflows.fetch_add(1UZ, std::memory_order_relaxed); }
+}
+
+}  // namespace detail::instrument
+
+// -------------------------------------------------------------------------------------------------
+// Snapshot of the statistics of one instantiation. The recommended capacity is the high-water mark,
+// or twice the capacity if the vectors overflowed, as their true demand was not observed then.
+struct CapacityReport {
+  std::string_view element;
+  size_t element_size;
+  size_t capacity;
+  size_t high_water_mark;
+  size_t pushes;
+  size_t pops;
+  size_t near_full;
+  size_t overflows;
+  std::array<size_t, detail::instrument::HISTOGRAM_BUCKETS> size_histogram;
+  size_t recommended_capacity;
+};
+
+// Statistics of every instantiation that was used so far.
+[[nodiscard]] inline auto capacity_reports() -> std::vector<CapacityReport> {
+  std::vector<CapacityReport> reports;
+  for (auto* s = detail::instrument::registry.load(std::memory_order_acquire); s != nullptr;
+       s       = s->next) {
+    CapacityReport report{
+        .element              = s->element,
+        .element_size         = s->element_size,
+        .capacity             = s->capacity,
+        .high_water_mark      = s->high_water_mark.load(std::memory_order_relaxed),
+        .pushes               = s->pushes.load(std::memory_order_relaxed),
+        .pops                 = s->pops.load(std::memory_order_relaxed),
+        .near_full            = s->near_full.load(std::memory_order_relaxed),
+        .overflows            = s->overflows.load(std::memory_order_relaxed),
+        .size_histogram       = {},
+        .recommended_capacity = 0UZ,
+    };
+    for (size_t i = 0; i < report.size_histogram.size(); ++i) {
+      report.size_histogram[i] = s->size_histogram[i].load(std::memory_order_relaxed);
+    }
+    report.recommended_capacity =
+        report.overflows > 0UZ ? 2UZ * report.capacity : std::max(report.high_water_mark, 1UZ);
+    reports.push_back(report);
+  }
+  return reports;
+}
+
+// One line per instantiation, followed by the size histogram in eighths of the capacity.
+inline void print_capacity_report(std::ostream& out) {
+  out << "StaticVector capacity report\n";
+  for (const auto& r : capacity_reports()) {
+    out << "  StaticVector<" << r.element << ", " << r.capacity << ">: high-water mark "
+        << r.high_water_mark << ", recommended capacity " << r.recommended_capacity
+        << ", pushes " << r.pushes << ", pops " << r.pops << ", near full " << r.near_full
+        << ", overflows " << r.overflows << "\n    sizes:";
+    for (const auto count : r.size_histogram) {
+      out << ' ' << count;
+    }
+    out << '\n';
+  }
+}
+
+// Prints the report to stderr when the program exits.
+inline void print_capacity_report_at_exit() noexcept {
+  std::atexit([] { print_capacity_report(std::cerr); });
+}
+
+#else
+
+namespace detail::instrument {
+
+template <typename Element, size_t CAPACITY>
+constexpr void on_push(size_t /*size*/) noexcept {}
+template <typename Element, size_t CAPACITY>
+constexpr void on_pop(size_t /*size*/) noexcept {}
+template <typename Element, size_t CAPACITY>
+constexpr void on_resize(size_t /*new_size*/) noexcept {}
+template <typename Element, size_t CAPACITY>
+constexpr void on_overflow() noexcept {}
+
+}  // namespace detail::instrument
+
+inline void print_capacity_report_at_exit() noexcept {}
+
+#endif  // SV_INSTRUMENTATION
+
+#endif  // INSTRUMENTATION_HPP_
@@ -0,0 +1,296 @@
+#ifndef MAPPED_STATIC_VECTOR_HPP_
+#define MAPPED_STATIC_VECTOR_HPP_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "StaticVector.hpp"
+
+// -------------------------------------------------------------------------------------------------
+// Binary file format for arrays of StaticVectors of trivially copyable elements, which is read by
+// mapping the file and using the stored vectors in place:
+//
+//   FileHeader   magic, version, byte order and the layout of the vector type
+//   padding      zeros up to `data_offset`, a multiple of the alignment of the vector
+//   vectors      `count` vectors with their object representation, spare elements zeroed
+//
+// The layout of a vector depends on the element type, the capacity, the alignment policy, the byte
+// order and the ABI, so a file can only be read by a program that agrees on all of them. The header
+// records what can be checked cheaply; the element type itself is identified by size and alignment
+// only.
+enum class FileError : std::uint8_t {
+  OPEN,     // The file cannot be opened or created.
+  IO,       // Reading, writing or mapping the file failed.
+  FORMAT,   // The file does not start with a valid header or its size does not match the header.
+  VERSION,  // The file was written in an unsupported version of the format.
+  LAYOUT,   // The file stores vectors of a different element type, capacity or alignment.
+};
+
+inline constexpr std::uint32_t STATIC_VECTOR_FILE_VERSION = 1U;
+
+namespace detail {
+
+inline constexpr std::array<char, 8> FILE_MAGIC{'S', 'V', 'E', 'C', 'T', 'O', 'R', '\0'};
+
+// Written in native byte order; reads back as a different value on a machine of the other order.
+inline constexpr std::uint32_t FILE_BYTE_ORDER = 0x01020304U;
+
+struct FileHeader {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint32_t element_size;
+  std::uint32_t element_alignment;
+  std::uint32_t vector_size;
+  std::uint32_t vector_alignment;
+  std::uint64_t capacity;
+  std::uint64_t count;
+  std::uint64_t data_offset;
+};
+static_assert(std::is_trivially_copyable_v<FileHeader> && sizeof(FileHeader) == 56UZ);
+
+// Vectors whose object representation is their value: the elements are trivially copyable and the
+// vector holds nothing but the elements and the size.
+template <typename Element, size_t CAPACITY, typename Alignment>
+concept MappableVector = std::is_trivially_copyable_v<Element> &&
+                         std::is_standard_layout_v<StaticVector<Element, CAPACITY, Alignment>> &&
+                         CAPACITY > 0UZ;
+
+template <typename Vector>
+[[nodiscard]] constexpr auto file_data_offset() noexcept -> size_t {
+  return (sizeof(FileHeader) + alignof(Vector) - 1UZ) / alignof(Vector) * alignof(Vector);
+}
+
+template <typename Element, size_t CAPACITY, typename Alignment>
+[[nodiscard]] constexpr auto make_file_header(size_t count) noexcept -> FileHeader {
+  using Vector = StaticVector<Element, CAPACITY, Alignment>;
+  return FileHeader{
+      .magic             = FILE_MAGIC,
+      .version           = STATIC_VECTOR_FILE_VERSION,
+      .byte_order        = FILE_BYTE_ORDER,
+      .element_size      = static_cast<std::uint32_t>(sizeof(Element)),
+      .element_alignment = static_cast<std::uint32_t>(alignof(Element)),
+      .vector_size       = static_cast<std::uint32_t>(sizeof(Vector)),
+      .vector_alignment  = static_cast<std::uint32_t>(alignof(Vector)),
+      .capacity          = CAPACITY,
+      .count             = count,
+      .data_offset       = file_data_offset<Vector>(),
+  };
+}
+
+// Writes all `size` bytes, retrying on partial writes and interrupts.
+[[nodiscard]] inline auto write_all(int fd, const std::byte* data, size_t size) noexcept -> bool {
+  while (size > 0UZ) {
+    const auto written = ::write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) { continue; }
+      return false;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+// Owns a file descriptor and closes it when leaving the scope.
+class FileDescriptor {
+  int m_fd;
+
+ public:
+  explicit FileDescriptor(int fd) noexcept : m_fd(fd) {}
+  FileDescriptor(const FileDescriptor&)                    = delete;
+  auto operator=(const FileDescriptor&) -> FileDescriptor& = delete;
+  ~FileDescriptor() noexcept {
+    if (m_fd >= 0) { ::close(m_fd); }
+  }
+
+  [[nodiscard]] auto get() const noexcept -> int { return m_fd; }
+};
+
+// Writes the header and the vectors through a buffer of about 64 KiB.
+template <typename Element, size_t CAPACITY, typename Alignment>
+  requires MappableVector<Element, CAPACITY, Alignment>
+[[nodiscard]] auto write_static_vectors(const char* path,
+                                        std::span<const StaticVector<Element, CAPACITY, Alignment>>
+                                            vectors) noexcept -> std::expected<void, FileError> {
+  using Vector                 = StaticVector<Element, CAPACITY, Alignment>;
+  using Size                   = SizeType<CAPACITY>;
+  constexpr size_t DATA_OFFSET = file_data_offset<Vector>();
+  constexpr size_t BATCH_SIZE  = std::max(64UZ * 1024UZ / sizeof(Vector), 1UZ);
+  // The size is the standard layout member behind the storage.
+  constexpr size_t SIZE_OFFSET =
+      (sizeof(UninitializedArray<Element, CAPACITY>) + alignof(Size) - 1UZ) / alignof(Size) *
+      alignof(Size);
+  static_assert(SIZE_OFFSET + sizeof(Size) <= sizeof(Vector));
+
+  const FileDescriptor file(::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644));
+  if (file.get() < 0) { return std::unexpected(FileError::OPEN); }
+
+  std::array<std::byte, DATA_OFFSET> head{};
+  const auto header = make_file_header<Element, CAPACITY, Alignment>(vectors.size());
+  std::memcpy(head.data(), &header, sizeof(header));
+  if (!write_all(file.get(), head.data(), head.size())) {
+    return std::unexpected(FileError::IO);
+  }
+
+  const auto buffer = std::make_unique_for_overwrite<std::byte[]>(BATCH_SIZE * sizeof(Vector));
+  for (size_t first = 0; first < vectors.size(); first += BATCH_SIZE) {
+    const auto batch = vectors.subspan(first, std::min(BATCH_SIZE, vectors.size() - first));
+    for (size_t i = 0; i < batch.size(); ++i) {
+      // Only the elements and the size are copied, the spare storage and the padding around the
+      // size are indeterminate in the vector and zeroed in the file.
+      const auto& vec = batch[i];
+      const auto used = vec.size() * sizeof(Element);
+      const auto size = static_cast<Size>(vec.size());
+      std::byte* dst  = buffer.get() + (i * sizeof(Vector));
+      std::memcpy(dst, vec.data(), used);
+      std::memset(dst + used, 0, sizeof(Vector) - used);
+      std::memcpy(dst + SIZE_OFFSET, &size, sizeof(size));
+    }
+    if (!write_all(file.get(), buffer.get(), batch.size() * sizeof(Vector))) {
+      return std::unexpected(FileError::IO);
+    }
+  }
+  return {};
+}
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Writes `vectors`, a contiguous range of StaticVectors, to a new file at `path`, replacing an
+// existing one. The vectors are written in batches through a buffer in which the spare elements
+// and the padding of the vector are zeroed, such that equal vectors of elements without padding
+// give equal files. Padding inside the elements is copied as it is.
+template <std::ranges::contiguous_range Range>
+  requires std::ranges::sized_range<Range>
+[[nodiscard]] auto write_static_vectors(const char* path, const Range& vectors) noexcept
+    -> std::expected<void, FileError> {
+  return detail::write_static_vectors(
+      path,
+      std::span<const std::ranges::range_value_t<Range>>{std::ranges::data(vectors),
+                                                          std::ranges::size(vectors)});
+}
+
+// -------------------------------------------------------------------------------------------------
+// Read-only view of the vectors in a file written by `write_static_vectors`. Opening the file
+// checks the header and maps the file, the vectors are then used in place: there is no copy and no
+// parsing, and only the pages that are accessed are ever read from disk.
+//
+// The sizes of the vectors are trusted. A file that was modified after it was written can make
+// them exceed the capacity, which the accessors only detect in debug builds.
+template <typename Element, size_t CAPACITY, typename Alignment = ElementAligned>
+  requires detail::MappableVector<Element, CAPACITY, Alignment>
+class MappedStaticVectors {
+ public:
+  using vector_type    = StaticVector<Element, CAPACITY, Alignment>;
+  using value_type     = vector_type;
+  using size_type      = size_t;
+  using const_iterator = const vector_type*;
+
+ private:
+  void* m_mapping       = nullptr;
+  size_t m_mapping_size = 0UZ;
+  std::span<const vector_type> m_vectors;
+
+  MappedStaticVectors(void* mapping, size_t mapping_size, size_t count) noexcept
+      : m_mapping(mapping),
+        m_mapping_size(mapping_size),
+        m_vectors(reinterpret_cast<const vector_type*>(  // NOLINT
+                      static_cast<const std::byte*>(mapping) +
+                      detail::file_data_offset<vector_type>()),
+                  count) {}
+
+ public:
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] static auto open(const char* path) noexcept
+      -> std::expected<MappedStaticVectors, FileError> {
+    const detail::FileDescriptor file(::open(path, O_RDONLY | O_CLOEXEC));
+    if (file.get() < 0) { return std::unexpected(FileError::OPEN); }
+
+    struct stat status {};
+    if (::fstat(file.get(), &status) != 0) { return std::unexpected(FileError::IO); }
+    const auto file_size = static_cast<size_t>(status.st_size);
+    if (file_size < sizeof(detail::FileHeader)) { return std::unexpected(FileError::FORMAT); }
+
+    void* mapping = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file.get(), 0);
+    if (mapping == MAP_FAILED) { return std::unexpected(FileError::IO); }
+    MappedStaticVectors mapped(mapping, file_size, 0UZ);
+
+    detail::FileHeader header{};
+    std::memcpy(&header, mapping, sizeof(header));
+    const auto expected = detail::make_file_header<Element, CAPACITY, Alignment>(header.count);
+    if (header.magic != detail::FILE_MAGIC) { return std::unexpected(FileError::FORMAT); }
+    if (header.version != expected.version) { return std::unexpected(FileError::VERSION); }
+    if (header.byte_order != expected.byte_order || header.element_size != expected.element_size ||
+        header.element_alignment != expected.element_alignment ||
+        header.vector_size != expected.vector_size ||
+        header.vector_alignment != expected.vector_alignment ||
+        header.capacity != expected.capacity || header.data_offset != expected.data_offset) {
+      return std::unexpected(FileError::LAYOUT);
+    }
+    if (file_size < header.data_offset ||
+        (file_size - header.data_offset) / sizeof(vector_type) != header.count ||
+        (file_size - header.data_offset) % sizeof(vector_type) != 0UZ) {
+      return std::unexpected(FileError::FORMAT);
+    }
+
+    mapped.m_vectors = std::span{mapped.m_vectors.data(), static_cast<size_t>(header.count)};
+    return mapped;
+  }
+
+  MappedStaticVectors(MappedStaticVectors&& other) noexcept
+      : m_mapping(std::exchange(other.m_mapping, nullptr)),
+        m_mapping_size(std::exchange(other.m_mapping_size, 0UZ)),
+        m_vectors(std::exchange(other.m_vectors, {})) {}
+  auto operator=(MappedStaticVectors&& other) noexcept -> MappedStaticVectors& {
+    if (this != &other) {
+      unmap();
+      m_mapping      = std::exchange(other.m_mapping, nullptr);
+      m_mapping_size = std::exchange(other.m_mapping_size, 0UZ);
+      m_vectors      = std::exchange(other.m_vectors, {});
+    }
+    return *this;
+  }
+  MappedStaticVectors(const MappedStaticVectors&)                    = delete;
+  auto operator=(const MappedStaticVectors&) -> MappedStaticVectors& = delete;
+  ~MappedStaticVectors() noexcept { unmap(); }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] auto operator[](size_t idx) const noexcept -> const vector_type& {
+    assert(idx < size() && "Index out of bounds.");
+    assert(m_vectors[idx].size() <= CAPACITY && "Stored size exceeds the capacity.");
+    return m_vectors[idx];
+  }
+  [[nodiscard]] auto vectors() const noexcept -> std::span<const vector_type> { return m_vectors; }
+
+  [[nodiscard]] auto size() const noexcept -> size_type { return m_vectors.size(); }
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_vectors.empty(); }
+
+  [[nodiscard]] auto begin() const noexcept -> const_iterator { return m_vectors.data(); }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return m_vectors.data() + m_vectors.size();
+  }
+
+ private:
+  void unmap() noexcept {
+    if (m_mapping != nullptr) { ::munmap(m_mapping, m_mapping_size); }
+  }
+};
+
+#endif  // MAPPED_STATIC_VECTOR_HPP_
@@ -0,0 +1,471 @@
+#ifndef PACKED_STATIC_VECTOR_HPP_
+#define PACKED_STATIC_VECTOR_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <type_traits>
+
+#include "StaticVector.hpp"
+
+namespace detail {
+
+// -------------------------------------------------------------------------------------------------
+// Fields of BITS bits packed into 64-bit words. A field never straddles two words, so the top
+// `64 % BITS` bits of every word are unused, e.g. one bit for 3-bit fields.
+template <size_t BITS>
+struct PackedLayout {
+  static_assert(BITS >= 1UZ && BITS <= 32UZ, "Packed fields must have between 1 and 32 bits.");
+
+  using Word  = std::uint64_t;
+  using Value = std::conditional_t<
+      BITS == 1UZ,
+      bool,
+      std::conditional_t<BITS <= 8UZ,
+                         std::uint8_t,
+                         std::conditional_t<BITS <= 16UZ, std::uint16_t, std::uint32_t>>>;
+
+  static constexpr size_t WORD_BITS = 64UZ;
+  static constexpr size_t PER_WORD  = WORD_BITS / BITS;
+  static constexpr Word FIELD       = (Word{1} << BITS) - 1U;
+
+  // Mask of the fields [first, last) of a word.
+  [[nodiscard]] static constexpr auto fields(size_t first, size_t last) noexcept -> Word {
+    const auto upto = [](size_t n) { return n == 64UZ ? ~Word{0} : (Word{1} << n) - 1U; };
+    return upto(last * BITS) & ~upto(first * BITS);
+  }
+
+  static constexpr Word USED = fields(0UZ, PER_WORD);
+  static constexpr Word LOWS = [] {
+    Word lows = 0U;
+    for (size_t i = 0; i < PER_WORD; ++i) {
+      lows |= Word{1} << (i * BITS);
+    }
+    return lows;
+  }();
+  static constexpr Word HIGHS = LOWS << (BITS - 1UZ);
+
+  // `value` in every field of a word.
+  [[nodiscard]] static constexpr auto broadcast(Word value) noexcept -> Word {
+    return value * LOWS;
+  }
+
+  // The top bit of every field that is zero in `word`. Adding the low bits of every field to the
+  // all-ones low bits carries into the top bit exactly if one of them is set, and never into the
+  // next field.
+  [[nodiscard]] static constexpr auto zero_fields(Word word) noexcept -> Word {
+    constexpr Word LOW_BITS = USED & ~HIGHS;
+    return ~(((word & LOW_BITS) + LOW_BITS) | word) & HIGHS;
+  }
+};
+
+// =================================================================================================
+// Proxy for a field, which converts to the value and assigns to the field through a const
+// reference like a pointer would.
+template <size_t BITS>
+class PackedReference {
+  using Layout = PackedLayout<BITS>;
+  using Word   = typename Layout::Word;
+  using Value  = typename Layout::Value;
+
+  Word* m_word;
+  size_t m_shift;
+
+ public:
+  constexpr PackedReference(Word* word, size_t shift) noexcept
+      : m_word(word),
+        m_shift(shift) {}
+  constexpr PackedReference(const PackedReference&) noexcept = default;
+
+  constexpr operator Value() const noexcept {  // NOLINT(google-explicit-constructor)
+    return static_cast<Value>((*m_word >> m_shift) & Layout::FIELD);
+  }
+
+  constexpr auto operator=(Value value) const noexcept -> const PackedReference& {
+    assert(Word{value} <= Layout::FIELD && "Value must fit into the field.");
+    *m_word = (*m_word & ~(Layout::FIELD << m_shift)) | (Word{value} << m_shift);
+    return *this;
+  }
+  constexpr auto operator=(const PackedReference& other) const noexcept -> const PackedReference& {
+    return *this = static_cast<Value>(other);
+  }
+
+  friend constexpr void swap(const PackedReference& a, const PackedReference& b) noexcept {
+    const auto tmp = static_cast<Value>(a);
+    a              = static_cast<Value>(b);
+    b              = tmp;
+  }
+};
+
+// =================================================================================================
+// Random access iterator over packed fields. Mutable iterators yield proxies, const iterators the
+// values.
+template <size_t BITS, bool IS_CONST>
+class PackedIterator {
+  using Layout = PackedLayout<BITS>;
+  using Word   = std::conditional_t<IS_CONST, const typename Layout::Word, typename Layout::Word>;
+
+  Word* m_words = nullptr;
+  size_t m_idx  = 0UZ;
+
+ public:
+  using iterator_concept  = std::random_access_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type   = ssize_t;
+  using value_type        = typename Layout::Value;
+  using reference = std::conditional_t<IS_CONST, value_type, PackedReference<BITS>>;
+
+  constexpr PackedIterator() noexcept = default;
+  constexpr PackedIterator(Word* words, size_t idx) noexcept
+      : m_words(words),
+        m_idx(idx) {}
+
+  // Mutable iterators convert to const iterators.
+  constexpr operator PackedIterator<BITS, true>() const noexcept
+  requires(!IS_CONST)
+  {
+    return PackedIterator<BITS, true>{m_words, m_idx};
+  }
+
+  constexpr auto operator==(const PackedIterator& other) const noexcept -> bool {
+    assert(m_words == other.m_words && "Iterators must belong to the same vector.");
+    return m_idx == other.m_idx;
+  }
+  constexpr auto operator<=>(const PackedIterator& other) const noexcept -> std::strong_ordering {
+    assert(m_words == other.m_words && "Iterators must belong to the same vector.");
+    return m_idx <=> other.m_idx;
+  }
+
+  constexpr auto operator*() const noexcept -> reference {
+    assert(m_words != nullptr && "PackedIterator must belong to a vector.");
+    Word* word         = m_words + (m_idx / Layout::PER_WORD);
+    const size_t shift = (m_idx % Layout::PER_WORD) * BITS;
+    if constexpr (IS_CONST) {
+      return static_cast<value_type>((*word >> shift) & Layout::FIELD);
+    } else {
+      return reference{word, shift};
+    }
+  }
+  constexpr auto operator[](difference_type offset) const noexcept -> reference {
+    return *(*this + offset);
+  }
+
+  constexpr auto operator++() noexcept -> PackedIterator& {
+    m_idx += 1UZ;
+    return *this;
+  }
+  constexpr auto operator++(int) noexcept -> PackedIterator {
+    const auto res  = *this;
+    m_idx          += 1UZ;
+    return res;
+  }
+  constexpr auto operator--() noexcept -> PackedIterator& {
+    m_idx -= 1UZ;
+    return *this;
+  }
+  constexpr auto operator--(int) noexcept -> PackedIterator {
+    const auto res  = *this;
+    m_idx          -= 1UZ;
+    return res;
+  }
+
+  constexpr auto operator+=(difference_type offset) noexcept -> PackedIterator& {
+    m_idx = static_cast<size_t>(static_cast<difference_type>(m_idx) + offset);
+    return *this;
+  }
+  constexpr auto operator-=(difference_type offset) noexcept -> PackedIterator& {
+    return *this += -offset;
+  }
+  constexpr auto operator+(difference_type offset) const noexcept -> PackedIterator {
+    auto res  = *this;
+    res      += offset;
+    return res;
+  }
+  constexpr auto operator-(difference_type offset) const noexcept -> PackedIterator {
+    auto res  = *this;
+    res      -= offset;
+    return res;
+  }
+  friend constexpr auto operator+(difference_type offset, const PackedIterator& it) noexcept
+      -> PackedIterator {
+    return it + offset;
+  }
+  constexpr auto operator-(const PackedIterator& other) const noexcept -> difference_type {
+    assert(m_words == other.m_words && "Iterators must belong to the same vector.");
+    return static_cast<difference_type>(m_idx) - static_cast<difference_type>(other.m_idx);
+  }
+};
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Vector of at most CAPACITY unsigned integers of BITS bits each, packed into 64-bit words. One-bit
+// elements are bools. Elements are accessed through proxy references like in `std::vector<bool>`;
+// `count`, `find_first`, `fill` and the set operations work on whole words, comparing all fields
+// of a word at once with a popcount or a count of trailing zeros.
+//
+// The fields behind the last element are always zero, so equal vectors have equal words.
+template <size_t BITS, size_t CAPACITY>
+class PackedStaticVector {
+  static_assert(CAPACITY > 0UZ, "PackedStaticVector requires a capacity greater than zero.");
+
+  using Layout = detail::PackedLayout<BITS>;
+  using Word   = typename Layout::Word;
+
+  static constexpr size_t WORDS = (CAPACITY + Layout::PER_WORD - 1UZ) / Layout::PER_WORD;
+
+  std::array<Word, WORDS> m_words{};
+  detail::SizeType<CAPACITY> m_size = 0U;
+
+ public:
+  using value_type             = typename Layout::Value;
+  using size_type              = size_t;
+  using difference_type        = ssize_t;
+  using reference              = detail::PackedReference<BITS>;
+  using const_reference        = value_type;
+  using iterator               = detail::PackedIterator<BITS, false>;
+  using const_iterator         = detail::PackedIterator<BITS, true>;
+  using reverse_iterator       = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using word_type              = Word;
+
+  static constexpr size_t bits_per_element  = BITS;
+  static constexpr size_t elements_per_word = Layout::PER_WORD;
+
+  constexpr PackedStaticVector() noexcept = default;
+  constexpr PackedStaticVector(size_t size, value_type value = value_type{}) noexcept {
+    resize(size, value);
+  }
+  constexpr PackedStaticVector(std::initializer_list<value_type> values) noexcept {
+    assert(values.size() <= CAPACITY && "Size may not exceed capacity.");
+    for (const auto value : values) {
+      push_back(value);
+    }
+  }
+
+  [[nodiscard]] constexpr auto operator==(const PackedStaticVector&) const noexcept -> bool =
+      default;
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto operator[](size_t idx) noexcept -> reference {
+    assert(idx < size() && "Index out of bounds.");
+    return reference{&m_words[idx / Layout::PER_WORD], (idx % Layout::PER_WORD) * BITS};
+  }
+  [[nodiscard]] constexpr auto operator[](size_t idx) const noexcept -> const_reference {
+    assert(idx < size() && "Index out of bounds.");
+    return get(idx);
+  }
+
+  [[nodiscard]] constexpr auto front() noexcept -> reference { return operator[](0UZ); }
+  [[nodiscard]] constexpr auto front() const noexcept -> const_reference {
+    return operator[](0UZ);
+  }
+  [[nodiscard]] constexpr auto back() noexcept -> reference { return operator[](size() - 1UZ); }
+  [[nodiscard]] constexpr auto back() const noexcept -> const_reference {
+    return operator[](size() - 1UZ);
+  }
+
+  // The words that hold the elements.
+  [[nodiscard]] constexpr auto words() const noexcept -> std::span<const Word> {
+    return std::span<const Word>{m_words.data(), word_count(size())};
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return m_size == 0U; }
+  [[nodiscard]] constexpr auto full() const noexcept -> bool { return m_size == CAPACITY; }
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] static constexpr auto max_size() noexcept -> size_type { return CAPACITY; }
+  [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return CAPACITY; }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator {
+    return iterator{m_words.data(), 0UZ};
+  }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+    return const_iterator{m_words.data(), 0UZ};
+  }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator {
+    return iterator{m_words.data(), size()};
+  }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator {
+    return const_iterator{m_words.data(), size()};
+  }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+  [[nodiscard]] constexpr auto rbegin() noexcept -> reverse_iterator {
+    return reverse_iterator{end()};
+  }
+  [[nodiscard]] constexpr auto rbegin() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{end()};
+  }
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> const_reverse_iterator {
+    return rbegin();
+  }
+  [[nodiscard]] constexpr auto rend() noexcept -> reverse_iterator {
+    return reverse_iterator{begin()};
+  }
+  [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{begin()};
+  }
+  [[nodiscard]] constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+  // -----------------------------------------------------------------------------------------------
+  constexpr void push_back(value_type value) noexcept {
+    assert(m_size < CAPACITY && "Size may not exceed capacity.");
+    assert(Word{value} <= Layout::FIELD && "Value must fit into the field.");
+    m_words[m_size / Layout::PER_WORD] |= Word{value} << ((m_size % Layout::PER_WORD) * BITS);
+    ++m_size;
+  }
+
+  constexpr auto pop_back() noexcept -> value_type {
+    assert(m_size > 0U && "Vector cannot be empty.");
+    --m_size;
+    const auto value = get(m_size);
+    m_words[m_size / Layout::PER_WORD] &= ~(Layout::FIELD << ((m_size % Layout::PER_WORD) * BITS));
+    return value;
+  }
+
+  constexpr void clear() noexcept {
+    std::fill_n(m_words.begin(), word_count(size()), Word{0});
+    m_size = 0U;
+  }
+
+  // Appended elements are `value`.
+  constexpr void resize(size_type new_size, value_type value = value_type{}) noexcept {
+    assert(new_size <= CAPACITY && "Size may not exceed capacity.");
+    if (new_size < size()) {
+      assign_range(new_size, size(), value_type{});
+    } else {
+      assign_range(size(), new_size, value);
+    }
+    m_size = static_cast<detail::SizeType<CAPACITY>>(new_size);
+  }
+
+  // Sets every element to `value`.
+  constexpr void fill(value_type value) noexcept { assign_range(0UZ, size(), value); }
+
+  // -----------------------------------------------------------------------------------------------
+  // Number of elements equal to `value`.
+  [[nodiscard]] constexpr auto count(value_type value) const noexcept -> size_type {
+    size_type res = 0UZ;
+    for_each_match(value, [&](size_t /*word*/, Word matches) {
+      res += static_cast<size_type>(std::popcount(matches));
+      return false;
+    });
+    return res;
+  }
+
+  // Index of the first element equal to `value`, or `size()` if there is none.
+  [[nodiscard]] constexpr auto find_first(value_type value) const noexcept -> size_type {
+    size_type res = size();
+    for_each_match(value, [&](size_t word, Word matches) {
+      res = (word * Layout::PER_WORD) + (static_cast<size_t>(std::countr_zero(matches)) / BITS);
+      return true;
+    });
+    return res;
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Set operations on one-bit elements of two vectors of the same size.
+  constexpr auto operator&=(const PackedStaticVector& other) noexcept -> PackedStaticVector&
+  requires(BITS == 1UZ)
+  {
+    return combine(other, [](Word a, Word b) { return a & b; });
+  }
+  constexpr auto operator|=(const PackedStaticVector& other) noexcept -> PackedStaticVector&
+  requires(BITS == 1UZ)
+  {
+    return combine(other, [](Word a, Word b) { return a | b; });
+  }
+  constexpr auto operator^=(const PackedStaticVector& other) noexcept -> PackedStaticVector&
+  requires(BITS == 1UZ)
+  {
+    return combine(other, [](Word a, Word b) { return a ^ b; });
+  }
+  // Inverts every element.
+  constexpr void flip() noexcept
+  requires(BITS == 1UZ)
+  {
+    const auto words = word_count(size());
+    for (size_t i = 0; i < words; ++i) {
+      m_words[i] = ~m_words[i];
+    }
+    if (words > 0UZ) { m_words[words - 1UZ] &= last_word_mask(); }
+  }
+
+ private:
+  [[nodiscard]] static constexpr auto word_count(size_t size) noexcept -> size_t {
+    return (size + Layout::PER_WORD - 1UZ) / Layout::PER_WORD;
+  }
+
+  [[nodiscard]] constexpr auto get(size_t idx) const noexcept -> value_type {
+    const auto word = m_words[idx / Layout::PER_WORD];
+    return static_cast<value_type>((word >> ((idx % Layout::PER_WORD) * BITS)) & Layout::FIELD);
+  }
+
+  // Mask of the fields of the last word that hold elements.
+  [[nodiscard]] constexpr auto last_word_mask() const noexcept -> Word {
+    const auto rem = size() % Layout::PER_WORD;
+    return Layout::fields(0UZ, rem == 0UZ ? Layout::PER_WORD : rem);
+  }
+
+  // Sets the elements [first, last) to `value`: the partial words at both ends are merged, the
+  // words between them are overwritten.
+  constexpr void assign_range(size_t first, size_t last, value_type value) noexcept {
+    if (first >= last) { return; }
+    const Word pattern = Layout::broadcast(Word{value});
+    const auto merge   = [&](size_t word, size_t begin, size_t end) {
+      const auto mask = Layout::fields(begin, end);
+      m_words[word]   = (m_words[word] & ~mask) | (pattern & mask);
+    };
+
+    const auto first_word = first / Layout::PER_WORD;
+    const auto last_word  = last / Layout::PER_WORD;
+    const auto first_rem  = first % Layout::PER_WORD;
+    const auto last_rem   = last % Layout::PER_WORD;
+    if (first_word == last_word) {
+      merge(first_word, first_rem, last_rem);
+      return;
+    }
+    auto word = first_word;
+    if (first_rem != 0UZ) { merge(word++, first_rem, Layout::PER_WORD); }
+    std::fill(m_words.begin() + word, m_words.begin() + last_word, pattern & Layout::USED);
+    if (last_rem != 0UZ) { merge(last_word, 0UZ, last_rem); }
+  }
+
+  // Calls `f(word, matches)` for every word with elements equal to `value`, where `matches` has
+  // the top bit of the matching fields set, until `f` returns true.
+  template <typename F>
+  constexpr void for_each_match(value_type value, F&& f) const noexcept {
+    const Word pattern = Layout::broadcast(Word{value});
+    const auto words   = word_count(size());
+    for (size_t i = 0; i < words; ++i) {
+      auto matches = Layout::zero_fields(m_words[i] ^ pattern);
+      if (i + 1UZ == words) { matches &= last_word_mask(); }
+      if (matches != 0U && f(i, matches)) { return; }
+    }
+  }
+
+  template <typename Op>
+  constexpr auto combine(const PackedStaticVector& other, Op op) noexcept -> PackedStaticVector& {
+    assert(size() == other.size() && "Vectors must have the same size.");
+    for (size_t i = 0; i < word_count(size()); ++i) {
+      m_words[i] = op(m_words[i], other.m_words[i]);
+    }
+    return *this;
+  }
+};
+
+// Vector of at most CAPACITY bools with one bit per element.
+template <size_t CAPACITY>
+using PackedBoolVector = PackedStaticVector<1UZ, CAPACITY>;
+
+#endif  // PACKED_STATIC_VECTOR_HPP_
@@ -6,51 +6,46 @@
 
 namespace detail {
 
+// Like std::reverse_iterator, the iterators store the position one past the element they refer to,
+// so `rend()` is `data()` and never points before the beginning of the storage.
+
 // =================================================================================================
 template <typename Element>
 class ReverseIterator {
   Element* m_ptr = nullptr;
 
  public:
-  using difference_type = ssize_t;
-  using value_type      = Element;
-  using element_type    = Element;
-  using pointer         = Element*;
-  using reference       = Element&;
+  using iterator_concept  = std::random_access_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type   = ssize_t;
+  using value_type        = Element;
+  using pointer           = Element*;
+  using reference         = Element&;
 
   constexpr ReverseIterator() noexcept = default;
-  constexpr ReverseIterator(Element* ptr) noexcept
-      : m_ptr(ptr) {}
+  constexpr explicit ReverseIterator(Element* base) noexcept
+      : m_ptr(base) {}
+
+  [[nodiscard]] constexpr auto base() const noexcept -> pointer { return m_ptr; }
 
-  constexpr auto operator==(const ReverseIterator<Element>& other) const noexcept -> bool {
+  constexpr auto operator==(const ReverseIterator& other) const noexcept -> bool {
     return m_ptr == other.m_ptr;
   }
 
-  constexpr auto operator<=>(const ReverseIterator<Element>& other) const noexcept {
-    return m_ptr <=> other.m_ptr;
+  constexpr auto operator<=>(const ReverseIterator& other) const noexcept {
+    return other.m_ptr <=> m_ptr;
   }
 
-  constexpr auto operator*() noexcept -> reference {
-    assert(m_ptr != nullptr && "ReverseIterator cannot point to nullptr.");
-    return *m_ptr;
-  }
   constexpr auto operator*() const noexcept -> reference {
     assert(m_ptr != nullptr && "ReverseIterator cannot point to nullptr.");
-    return *m_ptr;
-  }
-  constexpr auto operator->() noexcept -> pointer {
-    assert(m_ptr != nullptr && "ReverseIterator cannot point to nullptr.");
-    return m_ptr;
+    return *(m_ptr - 1);
   }
   constexpr auto operator->() const noexcept -> pointer {
     assert(m_ptr != nullptr && "ReverseIterator cannot point to nullptr.");
-    return m_ptr;
-  }
-  constexpr auto operator[](difference_type offset) noexcept -> reference {
-    return *(m_ptr - offset);
+    return m_ptr - 1;
   }
   constexpr auto operator[](difference_type offset) const noexcept -> reference {
-    return *(m_ptr - offset);
+    return *(m_ptr - offset - 1);
   }
 
   constexpr auto operator++() noexcept -> ReverseIterator& {
@@ -106,34 +101,39 @@ class ConstReverseIterator {
   const Element* m_ptr = nullptr;
 
  public:
-  using difference_type = ssize_t;
-  using value_type      = Element;
-  using element_type    = const Element;
-  using pointer         = const Element*;
-  using reference       = const Element&;
+  using iterator_concept  = std::random_access_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type   = ssize_t;
+  using value_type        = Element;
+  using pointer           = const Element*;
+  using reference         = const Element&;
 
   constexpr ConstReverseIterator() noexcept = default;
-  constexpr ConstReverseIterator(const Element* ptr) noexcept
-      : m_ptr(ptr) {}
+  constexpr explicit ConstReverseIterator(const Element* base) noexcept
+      : m_ptr(base) {}
+  constexpr ConstReverseIterator(ReverseIterator<Element> other) noexcept
+      : m_ptr(other.base()) {}
 
-  constexpr auto operator==(const ConstReverseIterator<Element>& other) const noexcept -> bool {
+  [[nodiscard]] constexpr auto base() const noexcept -> pointer { return m_ptr; }
+
+  constexpr auto operator==(const ConstReverseIterator& other) const noexcept -> bool {
     return m_ptr == other.m_ptr;
   }
 
-  constexpr auto operator<=>(const ConstReverseIterator<Element>& other) const noexcept {
-    return m_ptr <=> other.m_ptr;
+  constexpr auto operator<=>(const ConstReverseIterator& other) const noexcept {
+    return other.m_ptr <=> m_ptr;
   }
 
   constexpr auto operator*() const noexcept -> reference {
     assert(m_ptr != nullptr && "ReverseIterator cannot point to nullptr.");
-    return *m_ptr;
+    return *(m_ptr - 1);
   }
   constexpr auto operator->() const noexcept -> pointer {
     assert(m_ptr != nullptr && "ReverseIterator cannot point to nullptr.");
-    return m_ptr;
+    return m_ptr - 1;
   }
   constexpr auto operator[](difference_type offset) const noexcept -> reference {
-    return *(m_ptr - offset);
+    return *(m_ptr - offset - 1);
   }
 
   constexpr auto operator++() noexcept -> ConstReverseIterator& {
@@ -157,7 +157,7 @@ class ConstReverseIterator {
   }
 
   constexpr auto operator+(difference_type offset) const noexcept -> ConstReverseIterator {
-    return ReverseIterator{m_ptr - offset};
+    return ConstReverseIterator{m_ptr - offset};
   }
   constexpr auto operator+=(difference_type offset) noexcept -> ConstReverseIterator& {
     m_ptr -= offset;
@@ -170,7 +170,7 @@ class ConstReverseIterator {
   }
 
   constexpr auto operator-(difference_type offset) const noexcept -> ConstReverseIterator {
-    return ReverseIterator{m_ptr + offset};
+    return ConstReverseIterator{m_ptr + offset};
   }
   constexpr auto operator-=(difference_type offset) noexcept -> ConstReverseIterator& {
     m_ptr += offset;
@@ -184,23 +184,4 @@ class ConstReverseIterator {
 
 }  // namespace detail
 
-// =================================================================================================
-template <typename Element>
-struct std::iterator_traits<detail::ReverseIterator<Element>> {
-  using difference_type   = detail::ReverseIterator<Element>::difference_type;
-  using value_type        = detail::ReverseIterator<Element>::value_type;
-  using pointer           = detail::ReverseIterator<Element>::pointer;
-  using reference         = detail::ReverseIterator<Element>::reference;
-  using iterator_category = std::random_access_iterator_tag;
-};
-
-template <typename Element>
-struct std::iterator_traits<detail::ConstReverseIterator<Element>> {
-  using difference_type   = detail::ConstReverseIterator<Element>::difference_type;
-  using value_type        = detail::ConstReverseIterator<Element>::value_type;
-  using pointer           = detail::ConstReverseIterator<Element>::pointer;
-  using reference         = detail::ConstReverseIterator<Element>::reference;
-  using iterator_category = std::random_access_iterator_tag;
-};
-
 #endif  // REVERSE_ITERATOR_HPP_
@@ -0,0 +1,376 @@
+#ifndef SIMD_HPP_
+#define SIMD_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX512BW__) || defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+namespace detail::simd {
+
+// -------------------------------------------------------------------------------------------------
+// Width of the widest vector register the kernels are compiled for, zero if none is available.
+#if defined(__AVX512BW__)
+inline constexpr size_t REGISTER_BYTES = 64UZ;
+#elif defined(__AVX2__)
+inline constexpr size_t REGISTER_BYTES = 32UZ;
+#elif defined(__SSE4_2__)
+inline constexpr size_t REGISTER_BYTES = 16UZ;
+#else
+inline constexpr size_t REGISTER_BYTES = 0UZ;
+#endif
+
+template <typename T>
+concept Vectorizable =
+    REGISTER_BYTES > 0UZ && std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+    (sizeof(T) == 1UZ || sizeof(T) == 2UZ || sizeof(T) == 4UZ || sizeof(T) == 8UZ);
+
+template <Vectorizable T>
+inline constexpr size_t LANES = REGISTER_BYTES / sizeof(T);
+
+// -------------------------------------------------------------------------------------------------
+enum class Compare : std::uint8_t { EQ, NE, LT, LE, GT, GE };
+
+// Mask with the lowest `count` bits set, all bits if `count` exceeds the number of lanes.
+template <Vectorizable T>
+[[nodiscard]] constexpr auto lane_mask(size_t count) noexcept -> std::uint64_t {
+  if constexpr (LANES<T> == 64UZ) {
+    return count >= 64UZ ? ~std::uint64_t{0} : (std::uint64_t{1} << count) - 1U;
+  } else {
+    constexpr auto ALL = (std::uint64_t{1} << LANES<T>) - 1U;
+    return count >= LANES<T> ? ALL : (std::uint64_t{1} << count) - 1U;
+  }
+}
+
+// Moves the lanes of `src` whose bit is set in `keep` to `dst` in order, without a branch per lane,
+// and returns the number of moved lanes. `dst` may overlap `src` if it does not lie behind it.
+template <Vectorizable T>
+inline auto compress_scalar(T* dst, const T* src, size_t count, std::uint64_t keep) noexcept
+    -> size_t {
+  size_t out = 0UZ;
+  for (size_t i = 0; i < count; ++i) {
+    dst[out]  = src[i];
+    out      += static_cast<size_t>((keep >> i) & 1U);
+  }
+  return out;
+}
+
+#if defined(__AVX512BW__)
+
+// - AVX-512: compare straight into a mask register, masked loads for partial chunks ---------------
+template <Compare CMP>
+[[nodiscard]] consteval auto int_predicate() noexcept -> int {
+  switch (CMP) {
+    case Compare::EQ: return _MM_CMPINT_EQ;
+    case Compare::NE: return _MM_CMPINT_NE;
+    case Compare::LT: return _MM_CMPINT_LT;
+    case Compare::LE: return _MM_CMPINT_LE;
+    case Compare::GT: return _MM_CMPINT_NLE;
+    case Compare::GE: return _MM_CMPINT_NLT;
+  }
+  return _MM_CMPINT_EQ;
+}
+
+template <Compare CMP>
+[[nodiscard]] consteval auto float_predicate() noexcept -> int {
+  switch (CMP) {
+    case Compare::EQ: return _CMP_EQ_OQ;
+    case Compare::NE: return _CMP_NEQ_UQ;
+    case Compare::LT: return _CMP_LT_OQ;
+    case Compare::LE: return _CMP_LE_OQ;
+    case Compare::GT: return _CMP_GT_OQ;
+    case Compare::GE: return _CMP_GE_OQ;
+  }
+  return _CMP_EQ_OQ;
+}
+
+// Bit `i` is set if `lanes[i] CMP value` holds and bit `i` of `valid` is set. Lanes outside of
+// `valid` are not loaded.
+template <Compare CMP, Vectorizable T>
+[[nodiscard]] inline auto compare_mask(const T* lanes, T value, std::uint64_t valid) noexcept
+    -> std::uint64_t {
+  constexpr auto IP = int_predicate<CMP>();
+  constexpr auto FP = float_predicate<CMP>();
+  if constexpr (std::is_same_v<T, float>) {
+    const auto k = static_cast<__mmask16>(valid);
+    return _mm512_mask_cmp_ps_mask(k, _mm512_maskz_loadu_ps(k, lanes), _mm512_set1_ps(value), FP);
+  } else if constexpr (std::is_same_v<T, double>) {
+    const auto k = static_cast<__mmask8>(valid);
+    return _mm512_mask_cmp_pd_mask(k, _mm512_maskz_loadu_pd(k, lanes), _mm512_set1_pd(value), FP);
+  } else if constexpr (sizeof(T) == 1UZ) {
+    const auto k = static_cast<__mmask64>(valid);
+    const auto v = _mm512_maskz_loadu_epi8(k, lanes);
+    const auto b = _mm512_set1_epi8(static_cast<char>(value));
+    if constexpr (std::is_signed_v<T>) {
+      return _mm512_mask_cmp_epi8_mask(k, v, b, IP);
+    } else {
+      return _mm512_mask_cmp_epu8_mask(k, v, b, IP);
+    }
+  } else if constexpr (sizeof(T) == 2UZ) {
+    const auto k = static_cast<__mmask32>(valid);
+    const auto v = _mm512_maskz_loadu_epi16(k, lanes);
+    const auto b = _mm512_set1_epi16(static_cast<short>(value));
+    if constexpr (std::is_signed_v<T>) {
+      return _mm512_mask_cmp_epi16_mask(k, v, b, IP);
+    } else {
+      return _mm512_mask_cmp_epu16_mask(k, v, b, IP);
+    }
+  } else if constexpr (sizeof(T) == 4UZ) {
+    const auto k = static_cast<__mmask16>(valid);
+    const auto v = _mm512_maskz_loadu_epi32(k, lanes);
+    const auto b = _mm512_set1_epi32(static_cast<int>(value));
+    if constexpr (std::is_signed_v<T>) {
+      return _mm512_mask_cmp_epi32_mask(k, v, b, IP);
+    } else {
+      return _mm512_mask_cmp_epu32_mask(k, v, b, IP);
+    }
+  } else {
+    const auto k = static_cast<__mmask8>(valid);
+    const auto v = _mm512_maskz_loadu_epi64(k, lanes);
+    const auto b = _mm512_set1_epi64(static_cast<long long>(value));
+    if constexpr (std::is_signed_v<T>) {
+      return _mm512_mask_cmp_epi64_mask(k, v, b, IP);
+    } else {
+      return _mm512_mask_cmp_epu64_mask(k, v, b, IP);
+    }
+  }
+}
+
+// Masked loads never touch memory outside of `valid`, so every chunk can be loaded directly.
+template <Compare CMP, Vectorizable T, size_t CAPACITY>
+[[nodiscard]] inline auto chunk_mask(const T* data, size_t offset, T value, size_t count) noexcept
+    -> std::uint64_t {
+  return compare_mask<CMP>(data + offset, value, lane_mask<T>(count));
+}
+
+// Packs the lanes of `src` whose bit is set in `keep` to the front of a register with
+// `vpcompress` and stores them to `dst`. Bytes and words need VBMI2, without it they are moved one
+// by one.
+template <Vectorizable T, size_t CAPACITY>
+inline auto compress_chunk(T* dst, const T* src, size_t count, std::uint64_t keep) noexcept
+    -> size_t {
+  const auto kept = static_cast<size_t>(std::popcount(keep));
+  const auto load = lane_mask<T>(count);
+  const auto out  = lane_mask<T>(kept);
+  if constexpr (sizeof(T) == 4UZ) {
+    const auto v = _mm512_maskz_loadu_epi32(static_cast<__mmask16>(load), src);
+    _mm512_mask_storeu_epi32(dst,
+                             static_cast<__mmask16>(out),
+                             _mm512_maskz_compress_epi32(static_cast<__mmask16>(keep), v));
+  } else if constexpr (sizeof(T) == 8UZ) {
+    const auto v = _mm512_maskz_loadu_epi64(static_cast<__mmask8>(load), src);
+    _mm512_mask_storeu_epi64(dst,
+                             static_cast<__mmask8>(out),
+                             _mm512_maskz_compress_epi64(static_cast<__mmask8>(keep), v));
+#if defined(__AVX512VBMI2__)
+  } else if constexpr (sizeof(T) == 2UZ) {
+    const auto v = _mm512_maskz_loadu_epi16(static_cast<__mmask32>(load), src);
+    _mm512_mask_storeu_epi16(dst,
+                             static_cast<__mmask32>(out),
+                             _mm512_maskz_compress_epi16(static_cast<__mmask32>(keep), v));
+  } else if constexpr (sizeof(T) == 1UZ) {
+    const auto v = _mm512_maskz_loadu_epi8(static_cast<__mmask64>(load), src);
+    _mm512_mask_storeu_epi8(dst,
+                            static_cast<__mmask64>(out),
+                            _mm512_maskz_compress_epi8(static_cast<__mmask64>(keep), v));
+#endif
+  } else {
+    return compress_scalar(dst, src, count, keep);
+  }
+  return kept;
+}
+
+#elif defined(__AVX2__) || defined(__SSE4_2__)
+
+// - AVX2 / SSE: compare with GCC vector extensions, extract one bit per lane with movemask --------
+template <Vectorizable T>
+using Vector [[gnu::vector_size(REGISTER_BYTES)]] = T;
+
+template <Vectorizable T, typename Mask>
+[[nodiscard]] inline auto movemask(Mask m) noexcept -> std::uint64_t {
+#if defined(__AVX2__)
+  if constexpr (sizeof(T) == 1UZ) {
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(std::bit_cast<__m256i>(m)));
+  } else if constexpr (sizeof(T) == 2UZ) {
+    // Saturate to bytes, the 128-bit lanes are packed separately.
+    const auto packed = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+        _mm256_packs_epi16(std::bit_cast<__m256i>(m), _mm256_setzero_si256())));
+    return (packed & 0xFFU) | ((packed >> 8U) & 0xFF00U);
+  } else if constexpr (sizeof(T) == 4UZ) {
+    return static_cast<std::uint32_t>(_mm256_movemask_ps(std::bit_cast<__m256>(m)));
+  } else {
+    return static_cast<std::uint32_t>(_mm256_movemask_pd(std::bit_cast<__m256d>(m)));
+  }
+#else
+  if constexpr (sizeof(T) == 1UZ) {
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(std::bit_cast<__m128i>(m)));
+  } else if constexpr (sizeof(T) == 2UZ) {
+    return static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_packs_epi16(std::bit_cast<__m128i>(m), _mm_setzero_si128())));
+  } else if constexpr (sizeof(T) == 4UZ) {
+    return static_cast<std::uint32_t>(_mm_movemask_ps(std::bit_cast<__m128>(m)));
+  } else {
+    return static_cast<std::uint32_t>(_mm_movemask_pd(std::bit_cast<__m128d>(m)));
+  }
+#endif
+}
+
+// Bit `i` is set if `lanes[i] CMP value` holds, all `LANES<T>` lanes are loaded.
+template <Compare CMP, Vectorizable T>
+[[nodiscard]] inline auto compare_mask(const T* lanes, T value) noexcept -> std::uint64_t {
+  Vector<T> v;
+  std::memcpy(&v, lanes, sizeof(v));
+  // `value - 0` is folded into a plain broadcast, also for floating point types.
+  const Vector<T> b = value - Vector<T>{};
+  switch (CMP) {
+    case Compare::EQ: return movemask<T>(v == b);
+    case Compare::NE: return movemask<T>(v != b);
+    case Compare::LT: return movemask<T>(v < b);
+    case Compare::LE: return movemask<T>(v <= b);
+    case Compare::GT: return movemask<T>(v > b);
+    case Compare::GE: return movemask<T>(v >= b);
+  }
+  return 0U;
+}
+
+// A chunk that lies within the capacity of the vector is loaded completely, the lanes behind the
+// size are masked out afterwards. Only the last chunk of a capacity that is not a multiple of the
+// number of lanes has to be copied to a buffer first.
+template <Compare CMP, Vectorizable T, size_t CAPACITY>
+[[nodiscard]] inline auto chunk_mask(const T* data, size_t offset, T value, size_t count) noexcept
+    -> std::uint64_t {
+  if constexpr (CAPACITY >= LANES<T>) {
+    constexpr auto LAST_CHUNK_IS_FULL = CAPACITY % LANES<T> == 0UZ;
+    // Checking the offset instead of `count` lets the compiler see that the load stays within the
+    // storage, which also folds the check away in the unrolled loops.
+    if (LAST_CHUNK_IS_FULL || offset <= CAPACITY - LANES<T>) {
+      return compare_mask<CMP>(data + offset, value) & lane_mask<T>(count);
+    }
+  }
+  T buffer[LANES<T>]{};  // NOLINT
+  std::memcpy(buffer, data + offset, count * sizeof(T));
+  return compare_mask<CMP>(buffer, value) & lane_mask<T>(count);
+}
+
+#if defined(__AVX2__)
+// Permutations that move the lanes selected by the index to the front, as 32-bit lane indices.
+// Eight 32-bit lanes have 256 selections, four 64-bit lanes 16, which move pairs of 32-bit lanes.
+template <size_t LANE_BYTES>
+inline constexpr auto COMPRESS_PERMUTATIONS = [] {
+  constexpr size_t LANES_32 = 8UZ;
+  constexpr size_t WIDTH    = LANE_BYTES / 4UZ;
+  constexpr size_t LANES    = LANES_32 / WIDTH;
+  std::array<std::array<std::uint8_t, LANES_32>, 1UZ << LANES> table{};
+  for (size_t keep = 0; keep < table.size(); ++keep) {
+    size_t out = 0UZ;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+      if (((keep >> lane) & 1U) == 0U) { continue; }
+      for (size_t w = 0; w < WIDTH; ++w) {
+        table[keep][(out * WIDTH) + w] = static_cast<std::uint8_t>((lane * WIDTH) + w);
+      }
+      ++out;
+    }
+  }
+  return table;
+}();
+#endif
+
+// Packs the lanes of `src` whose bit is set in `keep` to the front of a register with a shuffle
+// looked up by the mask. The full register is loaded and stored, so chunks that reach past the
+// capacity and the elements without a 32-bit shuffle are moved one by one.
+template <Vectorizable T, size_t CAPACITY>
+inline auto compress_chunk(T* dst, const T* src, size_t count, std::uint64_t keep) noexcept
+    -> size_t {
+#if defined(__AVX2__)
+  if constexpr (sizeof(T) >= 4UZ && CAPACITY >= LANES<T>) {
+    if (CAPACITY % LANES<T> == 0UZ || count == LANES<T>) {
+      std::uint64_t indices;  // NOLINT
+      std::memcpy(&indices, COMPRESS_PERMUTATIONS<sizeof(T)>[keep].data(), sizeof(indices));
+      const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+      const auto p = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(indices)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_permutevar8x32_epi32(v, p));
+      return static_cast<size_t>(std::popcount(keep));
+    }
+  }
+#endif
+  return compress_scalar(dst, src, count, keep);
+}
+
+#endif
+
+// -------------------------------------------------------------------------------------------------
+// Vectors that span at most this many registers are scanned with a loop over the capacity, which
+// the compiler unrolls completely.
+inline constexpr size_t MAX_UNROLLED_CHUNKS = 8UZ;
+
+template <Vectorizable T, size_t CAPACITY>
+inline constexpr size_t CHUNKS = (CAPACITY + LANES<T> - 1UZ) / LANES<T>;
+
+// Index of the first `i` with `data[i] CMP value` in [0, size), `size` if there is none. `data`
+// must point to the storage of a vector with capacity `CAPACITY`.
+template <Compare CMP, Vectorizable T, size_t CAPACITY>
+[[nodiscard]] inline auto find_first(const T* data, size_t size, T value) noexcept -> size_t {
+  if constexpr (CHUNKS<T, CAPACITY> <= MAX_UNROLLED_CHUNKS) {
+#pragma GCC unroll 8
+    for (size_t c = 0; c < CHUNKS<T, CAPACITY>; ++c) {
+      const auto i = c * LANES<T>;
+      if (i >= size) { break; }
+      const auto mask = chunk_mask<CMP, T, CAPACITY>(data, i, value, size - i);
+      if (mask != 0U) { return i + static_cast<size_t>(std::countr_zero(mask)); }
+    }
+  } else {
+    for (size_t i = 0; i < size; i += LANES<T>) {
+      const auto mask = chunk_mask<CMP, T, CAPACITY>(data, i, value, size - i);
+      if (mask != 0U) { return i + static_cast<size_t>(std::countr_zero(mask)); }
+    }
+  }
+  return size;
+}
+
+// Number of `i` with `data[i] CMP value` in [0, size). `data` must point to the storage of a vector
+// with capacity `CAPACITY`.
+template <Compare CMP, Vectorizable T, size_t CAPACITY>
+[[nodiscard]] inline auto count(const T* data, size_t size, T value) noexcept -> size_t {
+  size_t res = 0UZ;
+  if constexpr (CHUNKS<T, CAPACITY> <= MAX_UNROLLED_CHUNKS) {
+    // Chunks behind the size are masked out completely, the loop does not need to branch.
+#pragma GCC unroll 8
+    for (size_t c = 0; c < CHUNKS<T, CAPACITY>; ++c) {
+      const auto i     = c * LANES<T>;
+      const auto mask  = chunk_mask<CMP, T, CAPACITY>(data, i, value, size - std::min(i, size));
+      res             += static_cast<size_t>(std::popcount(mask));
+    }
+  } else {
+    for (size_t i = 0; i < size; i += LANES<T>) {
+      const auto mask  = chunk_mask<CMP, T, CAPACITY>(data, i, value, size - i);
+      res             += static_cast<size_t>(std::popcount(mask));
+    }
+  }
+  return res;
+}
+
+// Removes every element with `data[i] CMP value` in [0, size) and moves the others to the front in
+// order, one register at a time. Returns the number of remaining elements. `data` must point to the
+// storage of a vector with capacity `CAPACITY`; the storage behind the remaining elements may be
+// overwritten.
+template <Compare CMP, Vectorizable T, size_t CAPACITY>
+[[nodiscard]] inline auto remove(T* data, size_t size, T value) noexcept -> size_t {
+  size_t out = 0UZ;
+  for (size_t i = 0; i < size; i += LANES<T>) {
+    const auto count  = std::min(size - i, LANES<T>);
+    const auto keep   = ~chunk_mask<CMP, T, CAPACITY>(data, i, value, count) & lane_mask<T>(count);
+    out              += compress_chunk<T, CAPACITY>(data + out, data + i, count, keep);
+  }
+  return out;
+}
+
+}  // namespace detail::simd
+
+#endif  // SIMD_HPP_
@@ -0,0 +1,568 @@
+#ifndef SMALL_VECTOR_HPP_
+#define SMALL_VECTOR_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "ReverseIterator.hpp"
+#include "StaticVector.hpp"
+#include "UninitializedArray.hpp"
+
+namespace detail {
+
+// -------------------------------------------------------------------------------------------------
+// Moves `count` elements from `src` into the uninitialized, non-overlapping storage at `dst` and
+// ends the lifetime of the source elements.
+template <typename Element>
+constexpr void relocate(Element* src, size_t count, Element* dst) noexcept {
+  if (relocate_with_memmove<Element>()) {
+    if (count > 0UZ) {
+      std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), count * sizeof(Element));
+    }
+  } else {
+    uninitialized_move(src, src + count, dst);
+    std::destroy_n(src, count);
+  }
+}
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Vector that stores up to `INLINE_CAPACITY` elements in place, like StaticVector, and moves them
+// to a heap buffer obtained from `Allocator` once it grows beyond that. The capacity grows
+// geometrically; the inline path only adds a well-predicted capacity check to StaticVector.
+//
+// Member functions that may allocate are not `noexcept`. The allocator propagates together with a
+// heap buffer on move assignment; it does not propagate on copy assignment or with inline elements.
+template <typename Element, size_t INLINE_CAPACITY, typename Allocator = std::allocator<Element>>
+class SmallVector {
+  static_assert(INLINE_CAPACITY > 0UZ, "Use a vector without inline storage instead.");
+  static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, Element>,
+                "Allocator must allocate elements.");
+
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+  detail::UninitializedArray<Element, INLINE_CAPACITY> m_inline;
+  Element* m_data          = m_inline.data();
+  size_t m_size            = 0UZ;
+  size_t m_capacity        = INLINE_CAPACITY;
+  [[no_unique_address]] Allocator m_allocator;
+
+ public:
+  using value_type             = Element;
+  using allocator_type         = Allocator;
+  using size_type              = size_t;
+  using difference_type        = ssize_t;
+  using reference              = value_type&;
+  using const_reference        = const value_type&;
+  using pointer                = value_type*;
+  using const_pointer          = const value_type*;
+  using iterator               = pointer;
+  using const_iterator         = const_pointer;
+  using reverse_iterator       = detail::ReverseIterator<Element>;
+  using const_reverse_iterator = detail::ConstReverseIterator<Element>;
+
+  static constexpr auto constructor_and_destructor_are_cheap =
+      detail::UninitializedArray<Element, INLINE_CAPACITY>::constructor_and_destructor_are_cheap;
+
+  static constexpr auto inline_capacity = INLINE_CAPACITY;
+
+  constexpr SmallVector() noexcept(std::is_nothrow_default_constructible_v<Allocator>) = default;
+  constexpr explicit SmallVector(const Allocator& allocator) noexcept
+      : m_allocator(allocator) {}
+  constexpr SmallVector(size_t size, const Element& init = Element{},
+                        const Allocator& allocator = Allocator{})
+      : m_allocator(allocator) {
+    reserve(size);
+    detail::uninitialized_fill_n(m_data, size, init);
+    m_size = size;
+  }
+  constexpr SmallVector(std::initializer_list<Element> values,
+                        const Allocator& allocator = Allocator{})
+      : m_allocator(allocator) {
+    append_copy(values.begin(), values.size());
+  }
+  template <detail::ContainerCompatibleRange<Element> Range>
+  constexpr SmallVector(detail::from_range_t /*tag*/, Range&& range,
+                        const Allocator& allocator = Allocator{})
+      : m_allocator(allocator) {
+    append_range(std::forward<Range>(range));
+  }
+
+  // - Copy constructor ----------------------------------------------------------------------------
+  constexpr SmallVector(const SmallVector& other)
+      : m_allocator(AllocTraits::select_on_container_copy_construction(other.m_allocator)) {
+    append_copy(other.data(), other.size());
+  }
+
+  // - Move constructor ----------------------------------------------------------------------------
+  // Takes over the heap buffer of `other`, inline elements are relocated. `other` is left empty.
+  constexpr SmallVector(SmallVector&& other) noexcept
+      : m_allocator(std::move(other.m_allocator)) {
+    if (other.is_inline()) {
+      detail::relocate(other.m_data, other.m_size, m_data);
+    } else {
+      m_data     = other.m_data;
+      m_capacity = other.m_capacity;
+    }
+    m_size = other.m_size;
+    other.reset_to_inline();
+  }
+
+  // - Copy assignment -----------------------------------------------------------------------------
+  constexpr auto operator=(const SmallVector& other) -> SmallVector& {
+    if (this != &other) {
+      clear();
+      append_copy(other.data(), other.size());
+    }
+    return *this;
+  }
+
+  // - Move assignment -----------------------------------------------------------------------------
+  // Takes over the heap buffer of `other` if the allocators allow it, otherwise the elements are
+  // relocated. `other` is left empty.
+  constexpr auto operator=(SmallVector&& other) noexcept(
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value) -> SmallVector& {
+    if (this == &other) { return *this; }
+
+    clear();
+    if (!other.is_inline() && can_take_buffer_of(other)) {
+      deallocate();
+      if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+        m_allocator = std::move(other.m_allocator);
+      }
+      m_data     = other.m_data;
+      m_capacity = other.m_capacity;
+      m_size     = other.m_size;
+      other.reset_to_inline();
+    } else {
+      reserve(other.m_size);
+      detail::relocate(other.m_data, other.m_size, m_data);
+      m_size       = other.m_size;
+      other.m_size = 0UZ;
+    }
+    return *this;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr ~SmallVector() noexcept {
+    clear();
+    deallocate();
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto operator[](size_t idx) noexcept -> reference {
+    return *(m_data + idx);
+  }
+  [[nodiscard]] constexpr auto operator[](size_t idx) const noexcept -> const_reference {
+    return *(m_data + idx);
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto data() noexcept -> pointer { return m_data; }
+  [[nodiscard]] constexpr auto data() const noexcept -> const_pointer { return m_data; }
+
+  [[nodiscard]] constexpr auto get_allocator() const noexcept -> allocator_type {
+    return m_allocator;
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return m_size == 0UZ; }
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] constexpr auto max_size() const noexcept -> size_type {
+    return std::max(AllocTraits::max_size(m_allocator), INLINE_CAPACITY);
+  }
+  [[nodiscard]] constexpr auto capacity() const noexcept -> size_type { return m_capacity; }
+
+  // Whether the elements are stored in place, i.e. no heap buffer is owned.
+  [[nodiscard]] constexpr auto is_inline() const noexcept -> bool {
+    return m_data == m_inline.data();
+  }
+
+  // Allocates a heap buffer for exactly `reserve_capacity` elements if the current one is smaller.
+  constexpr void reserve(size_type reserve_capacity) {
+    if (reserve_capacity > m_capacity) { reallocate(reserve_capacity); }
+  }
+
+  // Moves the elements back in place if they fit, otherwise into a heap buffer of exactly `size()`.
+  constexpr void shrink_to_fit() {
+    if (is_inline() || m_size == m_capacity) { return; }
+    reallocate(m_size);
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator { return m_data; }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return m_data; }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return m_data; }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator { return m_data + m_size; }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return m_data + m_size; }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return m_data + m_size; }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto rbegin() noexcept -> reverse_iterator {
+    return reverse_iterator{m_data + m_size};
+  }
+  [[nodiscard]] constexpr auto rbegin() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{m_data + m_size};
+  }
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{m_data + m_size};
+  }
+  [[nodiscard]] constexpr auto rend() noexcept -> reverse_iterator {
+    return reverse_iterator{m_data};
+  }
+  [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{m_data};
+  }
+  [[nodiscard]] constexpr auto crend() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{m_data};
+  }
+
+  // ------------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto front() noexcept -> reference {
+    assert(m_size > 0UZ && "Vector must contain at least one element.");
+    return operator[](0UZ);
+  }
+  [[nodiscard]] constexpr auto front() const noexcept -> const_reference {
+    assert(m_size > 0UZ && "Vector must contain at least one element.");
+    return operator[](0UZ);
+  }
+  [[nodiscard]] constexpr auto back() noexcept -> reference {
+    assert(m_size > 0UZ && "Vector must contain at least one element.");
+    return operator[](m_size - 1UZ);
+  }
+  [[nodiscard]] constexpr auto back() const noexcept -> const_reference {
+    assert(m_size > 0UZ && "Vector must contain at least one element.");
+    return operator[](m_size - 1UZ);
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Destroys the elements, but keeps the heap buffer.
+  constexpr void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<Element>) {
+      std::destroy_n(m_data, m_size);
+    }
+    m_size = 0UZ;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr void push_back(const Element& e) { emplace_back(e); }
+  constexpr void push_back(Element&& e) { emplace_back(std::move(e)); }
+
+  // -------------------------------------------------------------------------------------------------
+  template <typename... Args>
+  constexpr void emplace_back(Args&&... args) {
+    if (m_size == m_capacity) [[unlikely]] {
+      grow_and_emplace_back(std::forward<Args>(args)...);
+      return;
+    }
+    unchecked_emplace_back(std::forward<Args>(args)...);
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Appends the element without checking the capacity. The capacity must suffice, e.g. because it
+  // was reserved for a whole batch up front.
+  constexpr auto unchecked_push_back(const Element& e) noexcept -> reference {
+    return unchecked_emplace_back(e);
+  }
+  constexpr auto unchecked_push_back(Element&& e) noexcept -> reference {
+    return unchecked_emplace_back(std::move(e));
+  }
+
+  template <typename... Args>
+  constexpr auto unchecked_emplace_back(Args&&... args) noexcept -> reference {
+    Element* e = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+    ++m_size;
+    return *e;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr auto pop_back() noexcept -> value_type {
+    assert(m_size > 0 && "Vector cannot be empty.");
+    --m_size;
+    auto tmp = std::move(operator[](m_size));
+    std::destroy_at(m_data + m_size);
+    return tmp;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  template <typename... Args>
+  constexpr auto emplace(const_iterator pos, Args&&... args) -> iterator {
+    const auto idx = index_of(pos);
+    if (idx == m_size) {
+      emplace_back(std::forward<Args>(args)...);
+      return begin() + idx;
+    }
+
+    // Construct the new element before growing and shifting, `args` might refer to an element of
+    // the vector.
+    Element tmp(std::forward<Args>(args)...);
+    grow_to_fit(m_size + 1UZ);
+    const auto it = begin() + idx;
+    open_gap(it, 1UZ);
+    std::construct_at(it, std::move(tmp));
+    return it;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr auto insert(const_iterator pos, const Element& value) -> iterator {
+    return emplace(pos, value);
+  }
+  constexpr auto insert(const_iterator pos, Element&& value) -> iterator {
+    return emplace(pos, std::move(value));
+  }
+  constexpr auto insert(const_iterator pos, size_type count, const Element& value) -> iterator {
+    const auto idx = index_of(pos);
+    if (count == 0UZ) { return begin() + idx; }
+
+    const Element tmp(value);
+    grow_to_fit(m_size + count);
+    const auto it = begin() + idx;
+    open_gap(it, count);
+    detail::uninitialized_fill_n(it, count, tmp);
+    return it;
+  }
+  template <std::input_iterator InputIt>
+  constexpr auto insert(const_iterator pos, InputIt first, InputIt last) -> iterator {
+    return insert_range(pos, std::ranges::subrange(std::move(first), std::move(last)));
+  }
+  constexpr auto insert(const_iterator pos, std::initializer_list<Element> values) -> iterator {
+    return insert(pos, values.begin(), values.end());
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Inserts all elements of `range` before `pos`. If the size of `range` is known up front, the
+  // vector grows at most once and the elements are copied in bulk.
+  template <detail::ContainerCompatibleRange<Element> Range>
+  constexpr auto insert_range(const_iterator pos, Range&& range) -> iterator {
+    const auto idx = index_of(pos);
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>) {
+      const auto count = static_cast<size_type>(std::ranges::distance(range));
+      grow_to_fit(m_size + count);
+      const auto it = begin() + idx;
+      open_gap(it, count);
+      detail::copy_construct(it, std::ranges::begin(range), count);
+    } else {
+      // The number of elements is unknown up front: append them and rotate them into place.
+      const auto old_size = m_size;
+      append_range(std::forward<Range>(range));
+      std::rotate(begin() + idx, begin() + old_size, end());
+    }
+    return begin() + idx;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Appends all elements of `range`. If the size of `range` is known up front, the vector grows at
+  // most once and the elements are copied in bulk.
+  template <detail::ContainerCompatibleRange<Element> Range>
+  constexpr void append_range(Range&& range) {
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>) {
+      append_copy(std::ranges::begin(range), static_cast<size_type>(std::ranges::distance(range)));
+    } else {
+      for (auto&& e : range) {
+        emplace_back(std::forward<decltype(e)>(e));
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr void append(const Element* values, size_type count) { append_copy(values, count); }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr auto erase(const_iterator pos) noexcept -> iterator {
+    assert(pos != end() && "Cannot erase end iterator.");
+    return erase(pos, pos + 1);
+  }
+  constexpr auto erase(const_iterator first, const_iterator last) noexcept -> iterator {
+    assert(cbegin() <= first && first <= last && last <= cend() && "Invalid iterator range.");
+    const auto it_first = begin() + index_of(first);
+    const auto it_last  = begin() + index_of(last);
+    const auto count    = static_cast<size_type>(it_last - it_first);
+    if (count == 0UZ) { return it_first; }
+
+    if (detail::relocate_with_memmove<Element>()) {
+      std::destroy(it_first, it_last);
+      std::memmove(static_cast<void*>(it_first),
+                   static_cast<const void*>(it_last),
+                   static_cast<size_type>(end() - it_last) * sizeof(Element));
+    } else {
+      const auto new_end = std::move(it_last, end(), it_first);
+      std::destroy(new_end, end());
+    }
+    m_size -= count;
+    return it_first;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Exchanges heap buffers without touching the elements. Inline elements are swapped with the
+  // elements of the other vector or relocated into its inline storage. The allocators are swapped
+  // if they propagate on swap, otherwise they must compare equal.
+  constexpr void swap(SmallVector& other) noexcept {
+    if (this == &other) { return; }
+    if constexpr (AllocTraits::propagate_on_container_swap::value) {
+      using std::swap;
+      swap(m_allocator, other.m_allocator);
+    } else {
+      assert((AllocTraits::is_always_equal::value || m_allocator == other.m_allocator) &&
+             "Allocators must compare equal.");
+    }
+
+    if (!is_inline() && !other.is_inline()) {
+      std::swap(m_data, other.m_data);
+    } else if (is_inline() && other.is_inline()) {
+      auto& shorter = m_size <= other.m_size ? *this : other;
+      auto& longer  = m_size <= other.m_size ? other : *this;
+      std::swap_ranges(shorter.m_data, shorter.m_data + shorter.m_size, longer.m_data);
+      detail::relocate(longer.m_data + shorter.m_size,
+                       longer.m_size - shorter.m_size,
+                       shorter.m_data + shorter.m_size);
+    } else {
+      auto& small   = is_inline() ? *this : other;
+      auto& large   = is_inline() ? other : *this;
+      Element* heap = large.m_data;
+      large.m_data  = large.m_inline.data();
+      detail::relocate(small.m_data, small.m_size, large.m_data);
+      small.m_data = heap;
+    }
+    std::swap(m_size, other.m_size);
+    std::swap(m_capacity, other.m_capacity);
+  }
+
+  friend constexpr void swap(SmallVector& lhs, SmallVector& rhs) noexcept { lhs.swap(rhs); }
+
+  // -------------------------------------------------------------------------------------------------
+  // Appended elements are value-initialized, i.e. zeroed for scalar types.
+  constexpr void resize(size_type new_size) {
+    if (new_size <= m_size) {
+      std::destroy(begin() + new_size, end());
+    } else {
+      grow_to_fit(new_size);
+      detail::uninitialized_value_construct_n(end(), new_size - m_size);
+    }
+    m_size = new_size;
+  }
+  constexpr void resize(size_type new_size, const Element& value) {
+    if (new_size <= m_size) {
+      std::destroy(begin() + new_size, end());
+    } else {
+      // Copy first, `value` might refer to an element of the vector.
+      const Element tmp(value);
+      grow_to_fit(new_size);
+      detail::uninitialized_fill_n(end(), new_size - m_size, tmp);
+    }
+    m_size = new_size;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Appended elements are default-initialized, see StaticVector::resize_for_overwrite.
+  constexpr void resize_for_overwrite(size_type new_size)
+  requires(std::is_default_constructible_v<Element>)
+  {
+    if (new_size <= m_size) {
+      std::destroy(begin() + new_size, end());
+    } else {
+      grow_to_fit(new_size);
+      if constexpr (!constructor_and_destructor_are_cheap) {
+        std::uninitialized_default_construct(end(), begin() + new_size);
+      }
+    }
+    m_size = new_size;
+  }
+
+ private:
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto index_of(const_iterator pos) const noexcept -> size_type {
+    assert(cbegin() <= pos && pos <= cend() && "Iterator must be in [begin, end].");
+    return static_cast<size_type>(pos - cbegin());
+  }
+
+  [[nodiscard]] constexpr auto can_take_buffer_of(const SmallVector& other) const noexcept -> bool {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value ||
+                  AllocTraits::is_always_equal::value) {
+      return true;
+    } else {
+      return m_allocator == other.m_allocator;
+    }
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Forgets about the elements and the heap buffer, which now belong to another vector.
+  constexpr void reset_to_inline() noexcept {
+    m_data     = m_inline.data();
+    m_size     = 0UZ;
+    m_capacity = INLINE_CAPACITY;
+  }
+
+  constexpr void deallocate() noexcept {
+    if (!is_inline()) { AllocTraits::deallocate(m_allocator, m_data, m_capacity); }
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Relocates the elements into a heap buffer for `new_capacity` elements, or into the inline
+  // storage if they fit.
+  constexpr void reallocate(size_type new_capacity) {
+    Element* new_data = new_capacity <= INLINE_CAPACITY
+                            ? m_inline.data()
+                            : AllocTraits::allocate(m_allocator, new_capacity);
+    new_capacity      = std::max(new_capacity, INLINE_CAPACITY);
+    detail::relocate(m_data, m_size, new_data);
+    deallocate();
+    m_data     = new_data;
+    m_capacity = new_capacity;
+  }
+
+  // Grows geometrically, such that appending `n` elements one by one reallocates O(log n) times.
+  [[nodiscard]] constexpr auto next_capacity(size_type required) const noexcept -> size_type {
+    return std::max(2UZ * m_capacity, required);
+  }
+
+  constexpr void grow_to_fit(size_type required) {
+    if (required > m_capacity) [[unlikely]] { reallocate(next_capacity(required)); }
+  }
+
+  // The new element is constructed before the old elements are relocated, `args` might refer to
+  // one of them. Kept out of line to keep the inline path of `emplace_back` small.
+  template <typename... Args>
+  [[gnu::noinline]] constexpr void grow_and_emplace_back(Args&&... args) {
+    const auto new_capacity = next_capacity(m_size + 1UZ);
+    Element* new_data       = AllocTraits::allocate(m_allocator, new_capacity);
+    try {
+      std::construct_at(new_data + m_size, std::forward<Args>(args)...);
+    } catch (...) {
+      AllocTraits::deallocate(m_allocator, new_data, new_capacity);
+      throw;
+    }
+    detail::relocate(m_data, m_size, new_data);
+    deallocate();
+    m_data     = new_data;
+    m_capacity = new_capacity;
+    ++m_size;
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Shifts [pos, end) back by `count` elements, such that [pos, pos + count) is uninitialized
+  // storage afterwards, and accounts for the new elements in the size. The capacity must suffice.
+  constexpr void open_gap(iterator pos, size_type count) noexcept {
+    detail::shift_back(pos, end(), count);
+    m_size += count;
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  template <std::input_iterator InputIt>
+  constexpr void append_copy(InputIt src, size_type count) {
+    grow_to_fit(m_size + count);
+    detail::copy_construct(m_data + m_size, src, count);
+    m_size += count;
+  }
+};
+
+#endif  // SMALL_VECTOR_HPP_
@@ -0,0 +1,116 @@
+#ifndef SORTING_NETWORK_HPP_
+#define SORTING_NETWORK_HPP_
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <utility>
+
+namespace detail::network {
+
+// -------------------------------------------------------------------------------------------------
+// `LENGTH` comparators that order `data[LO + j]` before `data[HI + j]`. The comparators of a block
+// are independent of each other, a block is a loop over two non-overlapping slices.
+struct Block {
+  size_t lo;
+  size_t hi;
+  size_t length;
+};
+
+// Blocks of Batcher's merge exchange network for `N` elements (Knuth, TAOCP 5.2.2, Algorithm M),
+// which sorts any size. The comparators `(i, i + d)` of one pass with `i & p == r` form runs of
+// consecutive `i`, every run becomes a block.
+template <size_t N>
+[[nodiscard]] consteval auto block_count() noexcept -> size_t;
+
+template <size_t N, bool COUNT_ONLY>
+[[nodiscard]] consteval auto generate_blocks() noexcept {
+  constexpr size_t SIZE = COUNT_ONLY ? 1UZ : block_count<N>();
+  std::array<Block, SIZE> blocks{};
+  size_t count = 0UZ;
+
+  const auto add_block = [&](size_t lo, size_t hi, size_t length) {
+    if constexpr (!COUNT_ONLY) { blocks[count] = Block{lo, hi, length}; }
+    ++count;
+  };
+
+  if constexpr (N > 1UZ) {
+    const size_t top = std::bit_ceil(N) / 2UZ;
+    for (size_t p = top; p > 0UZ; p /= 2UZ) {
+      size_t q = top;
+      size_t r = 0UZ;
+      size_t d = p;
+      while (true) {
+        size_t run_begin  = 0UZ;
+        size_t run_length = 0UZ;
+        for (size_t i = 0; i + d < N; ++i) {
+          if ((i & p) != r) { continue; }
+          if (run_length > 0UZ && run_begin + run_length == i) {
+            ++run_length;
+          } else {
+            if (run_length > 0UZ) { add_block(run_begin, run_begin + d, run_length); }
+            run_begin  = i;
+            run_length = 1UZ;
+          }
+        }
+        if (run_length > 0UZ) { add_block(run_begin, run_begin + d, run_length); }
+
+        if (q == p) { break; }
+        d  = q - p;
+        q /= 2UZ;
+        r  = p;
+      }
+    }
+  }
+
+  if constexpr (COUNT_ONLY) {
+    return count;
+  } else {
+    return blocks;
+  }
+}
+
+template <size_t N>
+[[nodiscard]] consteval auto block_count() noexcept -> size_t {
+  return generate_blocks<N, true>();
+}
+
+template <size_t N>
+inline constexpr auto BLOCKS = generate_blocks<N, false>();
+
+// -------------------------------------------------------------------------------------------------
+// Orders `lo` before `hi`. Both results select on the same comparison, so equivalent but
+// distinguishable elements like -0.0 and 0.0 are swapped or kept but never duplicated. For
+// arithmetic elements the selects compile to min/max or blend instructions. Both results are
+// computed before either is stored, otherwise GCC turns the selects into a masked store of the
+// swapped lanes behind a branch that skips it.
+template <typename Element, typename Compare>
+constexpr void compare_exchange(Element& lo, Element& hi, Compare& comp) noexcept {
+  const Element a     = lo;
+  const Element b     = hi;
+  const bool swapped  = comp(b, a);
+  const Element first = swapped ? b : a;
+  const Element last  = swapped ? a : b;
+  lo                  = first;
+  hi                  = last;
+}
+
+template <Block BLOCK, typename Element, typename Compare>
+constexpr void apply_block(Element* data, Compare& comp) noexcept {
+  for (size_t j = 0; j < BLOCK.length; ++j) {
+    compare_exchange(data[BLOCK.lo + j], data[BLOCK.hi + j], comp);
+  }
+}
+
+// Sorts `data[0, N)`. The blocks are expanded at compile time, so the compiler sees straight-line
+// code with loops of constant length that it vectorizes.
+template <size_t N, typename Element, typename Compare>
+constexpr void sort(Element* data, Compare& comp) noexcept {
+  [&]<size_t... Is>(std::index_sequence<Is...> /*indices*/) {
+    (apply_block<BLOCKS<N>[Is]>(data, comp), ...);
+  }(std::make_index_sequence<BLOCKS<N>.size()>{});
+}
+
+}  // namespace detail::network
+
+#endif  // SORTING_NETWORK_HPP_
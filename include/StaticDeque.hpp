@@ -0,0 +1,371 @@
+#ifndef STATIC_DEQUE_HPP_
+#define STATIC_DEQUE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "StaticVector.hpp"
+#include "UninitializedArray.hpp"
+
+namespace detail {
+
+// -------------------------------------------------------------------------------------------------
+// Position of the unwrapped index `idx` < 2 * CAPACITY in a ring of CAPACITY slots. A power of two
+// capacity wraps with a mask, any other capacity with a conditional subtraction instead of a
+// division.
+template <size_t CAPACITY>
+[[nodiscard]] constexpr auto ring_index(size_t idx) noexcept -> size_t {
+  if constexpr (std::has_single_bit(CAPACITY)) {
+    return idx & (CAPACITY - 1UZ);
+  } else {
+    assert(idx < 2UZ * CAPACITY && "Index must be less than twice the capacity.");
+    return idx >= CAPACITY ? idx - CAPACITY : idx;
+  }
+}
+
+// =================================================================================================
+// Random access iterator over the elements of a StaticDeque. It stores the unwrapped index of the
+// element, which lies in [head, head + size], and wraps it on dereferencing.
+template <typename Element, size_t CAPACITY>
+class RingIterator {
+  Element* m_data = nullptr;
+  size_t m_idx    = 0UZ;
+
+ public:
+  using iterator_concept  = std::random_access_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type   = ssize_t;
+  using value_type        = std::remove_const_t<Element>;
+  using pointer           = Element*;
+  using reference         = Element&;
+
+  constexpr RingIterator() noexcept = default;
+  constexpr RingIterator(Element* data, size_t idx) noexcept
+      : m_data(data),
+        m_idx(idx) {}
+
+  // Mutable iterators convert to const iterators.
+  constexpr operator RingIterator<const Element, CAPACITY>() const noexcept {
+    return RingIterator<const Element, CAPACITY>{m_data, m_idx};
+  }
+
+  constexpr auto operator==(const RingIterator& other) const noexcept -> bool {
+    assert(m_data == other.m_data && "Iterators must belong to the same deque.");
+    return m_idx == other.m_idx;
+  }
+  constexpr auto operator<=>(const RingIterator& other) const noexcept -> std::strong_ordering {
+    assert(m_data == other.m_data && "Iterators must belong to the same deque.");
+    return m_idx <=> other.m_idx;
+  }
+
+  constexpr auto operator*() const noexcept -> reference {
+    assert(m_data != nullptr && "RingIterator must belong to a deque.");
+    return m_data[ring_index<CAPACITY>(m_idx)];
+  }
+  constexpr auto operator->() const noexcept -> pointer { return &**this; }
+  constexpr auto operator[](difference_type offset) const noexcept -> reference {
+    return *(*this + offset);
+  }
+
+  constexpr auto operator++() noexcept -> RingIterator& {
+    m_idx += 1UZ;
+    return *this;
+  }
+  constexpr auto operator++(int) noexcept -> RingIterator {
+    const auto res  = *this;
+    m_idx          += 1UZ;
+    return res;
+  }
+  constexpr auto operator--() noexcept -> RingIterator& {
+    m_idx -= 1UZ;
+    return *this;
+  }
+  constexpr auto operator--(int) noexcept -> RingIterator {
+    const auto res  = *this;
+    m_idx          -= 1UZ;
+    return res;
+  }
+
+  constexpr auto operator+=(difference_type offset) noexcept -> RingIterator& {
+    m_idx = static_cast<size_t>(static_cast<difference_type>(m_idx) + offset);
+    return *this;
+  }
+  constexpr auto operator-=(difference_type offset) noexcept -> RingIterator& {
+    return *this += -offset;
+  }
+  constexpr auto operator+(difference_type offset) const noexcept -> RingIterator {
+    auto res  = *this;
+    res      += offset;
+    return res;
+  }
+  constexpr auto operator-(difference_type offset) const noexcept -> RingIterator {
+    auto res  = *this;
+    res      -= offset;
+    return res;
+  }
+  friend constexpr auto operator+(difference_type offset, const RingIterator& it) noexcept
+      -> RingIterator {
+    return it + offset;
+  }
+  constexpr auto operator-(const RingIterator& other) const noexcept -> difference_type {
+    assert(m_data == other.m_data && "Iterators must belong to the same deque.");
+    return static_cast<difference_type>(m_idx) - static_cast<difference_type>(other.m_idx);
+  }
+};
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Fixed-capacity double-ended queue: a ring buffer on the uninitialized storage of StaticVector.
+// Elements are added and removed at both ends in O(1), e.g. for a sliding window. The elements are
+// stored in up to two contiguous segments, which `segments()` exposes for bulk copies.
+template <typename Element, size_t CAPACITY>
+class StaticDeque {
+  static_assert(CAPACITY > 0UZ, "StaticDeque requires a capacity greater than zero.");
+
+  detail::UninitializedArray<Element, CAPACITY> m_storage;
+  detail::SizeType<CAPACITY> m_head = 0U;
+  detail::SizeType<CAPACITY> m_size = 0U;
+
+ public:
+  using value_type             = Element;
+  using size_type              = size_t;
+  using difference_type        = ssize_t;
+  using reference              = value_type&;
+  using const_reference        = const value_type&;
+  using pointer                = value_type*;
+  using const_pointer          = const value_type*;
+  using iterator               = detail::RingIterator<Element, CAPACITY>;
+  using const_iterator         = detail::RingIterator<const Element, CAPACITY>;
+  using reverse_iterator       = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  constexpr StaticDeque() noexcept = default;
+  constexpr StaticDeque(std::initializer_list<Element> values) noexcept {
+    append(values.begin(), values.size());
+  }
+
+  // - Copy / move ---------------------------------------------------------------------------------
+  // The elements of the new deque start at the beginning of the storage.
+  constexpr StaticDeque(const StaticDeque& other) noexcept { append_copy(other); }
+  constexpr StaticDeque(StaticDeque&& other) noexcept { append_move(other); }
+
+  constexpr auto operator=(const StaticDeque& other) noexcept -> StaticDeque& {
+    if (this != &other) {
+      clear();
+      append_copy(other);
+    }
+    return *this;
+  }
+  constexpr auto operator=(StaticDeque&& other) noexcept -> StaticDeque& {
+    if (this != &other) {
+      clear();
+      append_move(other);
+    }
+    return *this;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr ~StaticDeque() noexcept = default;
+  constexpr ~StaticDeque() noexcept
+  requires(!std::is_trivially_destructible_v<Element>)
+  {
+    clear();
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto operator[](size_t idx) noexcept -> reference {
+    return m_storage.data()[slot(idx)];
+  }
+  [[nodiscard]] constexpr auto operator[](size_t idx) const noexcept -> const_reference {
+    return m_storage.data()[slot(idx)];
+  }
+
+  // The elements in order: from the head to the end of the storage, and the elements that wrapped
+  // around to the beginning of the storage. The second segment is empty if none wrapped around.
+  [[nodiscard]] constexpr auto segments() noexcept -> std::array<std::span<Element>, 2> {
+    const auto first = first_segment_size();
+    return {std::span<Element>{m_storage.data() + m_head, first},
+            std::span<Element>{m_storage.data(), m_size - first}};
+  }
+  [[nodiscard]] constexpr auto segments() const noexcept
+      -> std::array<std::span<const Element>, 2> {
+    const auto first = first_segment_size();
+    return {std::span<const Element>{m_storage.data() + m_head, first},
+            std::span<const Element>{m_storage.data(), m_size - first}};
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return m_size == 0UZ; }
+  [[nodiscard]] constexpr auto full() const noexcept -> bool { return m_size == CAPACITY; }
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] constexpr auto max_size() const noexcept -> size_type { return CAPACITY; }
+  [[nodiscard]] constexpr auto capacity() const noexcept -> size_type { return CAPACITY; }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator {
+    return iterator{m_storage.data(), m_head};
+  }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+    return const_iterator{m_storage.data(), m_head};
+  }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator {
+    return iterator{m_storage.data(), size_t{m_head} + m_size};
+  }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator {
+    return const_iterator{m_storage.data(), size_t{m_head} + m_size};
+  }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto rbegin() noexcept -> reverse_iterator {
+    return reverse_iterator{end()};
+  }
+  [[nodiscard]] constexpr auto rbegin() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{end()};
+  }
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> const_reverse_iterator {
+    return rbegin();
+  }
+  [[nodiscard]] constexpr auto rend() noexcept -> reverse_iterator {
+    return reverse_iterator{begin()};
+  }
+  [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{begin()};
+  }
+  [[nodiscard]] constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+  // ------------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto front() noexcept -> reference {
+    assert(m_size > 0UZ && "Deque must contain at least one element.");
+    return operator[](0UZ);
+  }
+  [[nodiscard]] constexpr auto front() const noexcept -> const_reference {
+    assert(m_size > 0UZ && "Deque must contain at least one element.");
+    return operator[](0UZ);
+  }
+  [[nodiscard]] constexpr auto back() noexcept -> reference {
+    assert(m_size > 0UZ && "Deque must contain at least one element.");
+    return operator[](m_size - 1UZ);
+  }
+  [[nodiscard]] constexpr auto back() const noexcept -> const_reference {
+    assert(m_size > 0UZ && "Deque must contain at least one element.");
+    return operator[](m_size - 1UZ);
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<Element>) {
+      for (const auto segment : segments()) {
+        std::destroy(segment.begin(), segment.end());
+      }
+    }
+    m_head = 0U;
+    m_size = 0U;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr void push_back(const Element& e) noexcept { emplace_back(e); }
+  constexpr void push_back(Element&& e) noexcept { emplace_back(std::move(e)); }
+
+  template <typename... Args>
+  constexpr void emplace_back(Args&&... args) noexcept {
+    assert(m_size < CAPACITY && "Size may not exceed capacity.");
+    std::construct_at(m_storage.data() + slot(m_size), std::forward<Args>(args)...);
+    ++m_size;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr void push_front(const Element& e) noexcept { emplace_front(e); }
+  constexpr void push_front(Element&& e) noexcept { emplace_front(std::move(e)); }
+
+  template <typename... Args>
+  constexpr void emplace_front(Args&&... args) noexcept {
+    assert(m_size < CAPACITY && "Size may not exceed capacity.");
+    const auto head = detail::ring_index<CAPACITY>(m_head + CAPACITY - 1UZ);
+    std::construct_at(m_storage.data() + head, std::forward<Args>(args)...);
+    m_head = static_cast<detail::SizeType<CAPACITY>>(head);
+    ++m_size;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr auto pop_back() noexcept -> value_type {
+    assert(m_size > 0 && "Deque cannot be empty.");
+    --m_size;
+    Element* e = m_storage.data() + slot(m_size);
+    auto tmp   = std::move(*e);
+    std::destroy_at(e);
+    return tmp;
+  }
+
+  constexpr auto pop_front() noexcept -> value_type {
+    assert(m_size > 0 && "Deque cannot be empty.");
+    Element* e = m_storage.data() + m_head;
+    auto tmp   = std::move(*e);
+    std::destroy_at(e);
+    m_head = static_cast<detail::SizeType<CAPACITY>>(slot(1UZ));
+    --m_size;
+    return tmp;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Copies `count` elements behind the last element, with at most two bulk copies.
+  constexpr void append(const Element* values, size_type count) noexcept {
+    assert(m_size + count <= CAPACITY && "Size may not exceed capacity.");
+    const auto tail  = slot(m_size);
+    const auto first = std::min(count, CAPACITY - tail);
+    detail::copy_construct(m_storage.data() + tail, values, first);
+    detail::copy_construct(m_storage.data(), values + first, count - first);
+    m_size = static_cast<detail::SizeType<CAPACITY>>(m_size + count);
+  }
+
+  // Removes the `count` first elements.
+  constexpr void drop_front(size_type count) noexcept {
+    assert(count <= m_size && "Cannot drop more elements than the deque contains.");
+    if constexpr (!std::is_trivially_destructible_v<Element>) {
+      std::destroy(begin(), begin() + static_cast<difference_type>(count));
+    }
+    m_head = static_cast<detail::SizeType<CAPACITY>>(slot(count));
+    m_size = static_cast<detail::SizeType<CAPACITY>>(m_size - count);
+  }
+
+ private:
+  // Slot of the element at `idx` <= CAPACITY.
+  [[nodiscard]] constexpr auto slot(size_type idx) const noexcept -> size_type {
+    return detail::ring_index<CAPACITY>(m_head + idx);
+  }
+
+  [[nodiscard]] constexpr auto first_segment_size() const noexcept -> size_type {
+    return std::min<size_type>(m_size, CAPACITY - m_head);
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  constexpr void append_copy(const StaticDeque& other) noexcept {
+    for (const auto segment : other.segments()) {
+      append(segment.data(), segment.size());
+    }
+  }
+
+  // Move-constructs the elements of `other` behind the last element. The moved-from elements stay
+  // alive in `other`.
+  constexpr void append_move(StaticDeque& other) noexcept {
+    for (const auto segment : other.segments()) {
+      for (auto& e : segment) {
+        emplace_back(std::move(e));
+      }
+    }
+  }
+};
+
+#endif  // STATIC_DEQUE_HPP_
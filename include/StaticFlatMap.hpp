@@ -0,0 +1,253 @@
+#ifndef STATIC_FLAT_MAP_HPP_
+#define STATIC_FLAT_MAP_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <tuple>
+#include <utility>
+
+#include "StaticFlatSet.hpp"
+#include "StaticSoAVector.hpp"
+#include "StaticVector.hpp"
+
+namespace detail {
+
+// -------------------------------------------------------------------------------------------------
+// Keys and values of a StaticFlatMap in two vectors, which always have the same size. Exposes the
+// columns to SoAIterator.
+template <typename Key, typename Value, size_t CAPACITY>
+struct FlatMapColumns {
+  StaticVector<Key, CAPACITY> keys;
+  StaticVector<Value, CAPACITY> values;
+
+  template <size_t I>
+  [[nodiscard]] constexpr auto data() noexcept {
+    if constexpr (I == 0UZ) {
+      return keys.data();
+    } else {
+      return values.data();
+    }
+  }
+  template <size_t I>
+  [[nodiscard]] constexpr auto data() const noexcept {
+    if constexpr (I == 0UZ) {
+      return keys.data();
+    } else {
+      return values.data();
+    }
+  }
+};
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Map of at most CAPACITY entries, sorted by key. Keys and values are stored in separate
+// StaticVectors, such that a lookup only touches the keys: small maps are searched with a
+// vectorized linear scan, larger ones with a branchless binary search. Inserting and erasing shift
+// the entries behind the position, which is a memmove for trivially relocatable types.
+//
+// Iterators yield rows of references like StaticSoAVector, `std::get<0>(*it)` is the key.
+template <typename Key, typename Value, size_t CAPACITY, typename Compare = std::less<Key>>
+class StaticFlatMap {
+  static_assert(CAPACITY > 0UZ, "StaticFlatMap requires a capacity greater than zero.");
+
+  using Columns = detail::FlatMapColumns<Key, Value, CAPACITY>;
+
+  Columns m_columns;
+  [[no_unique_address]] Compare m_compare;
+
+ public:
+  using key_type        = Key;
+  using mapped_type     = Value;
+  using value_type      = std::tuple<Key, Value>;
+  using key_compare     = Compare;
+  using size_type       = size_t;
+  using difference_type = ssize_t;
+  using reference       = detail::SoARow<const Key&, Value&>;
+  using const_reference = detail::SoARow<const Key&, const Value&>;
+  using iterator        = detail::SoAIterator<Columns, const Key, Value>;
+  using const_iterator  = detail::SoAIterator<const Columns, const Key, const Value>;
+
+  constexpr StaticFlatMap() noexcept = default;
+  constexpr StaticFlatMap(std::initializer_list<value_type> entries) noexcept {
+    assert(entries.size() <= CAPACITY && "Size may not exceed capacity.");
+    for (const auto& [key, value] : entries) {
+      try_emplace(key, value);
+    }
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator { return iterator{&m_columns, 0}; }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return cbegin(); }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator { return begin() + ssize(); }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return cend(); }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator {
+    return const_iterator{&m_columns, 0};
+  }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator {
+    return cbegin() + ssize();
+  }
+
+  // The keys in order and the values in the order of their keys.
+  [[nodiscard]] constexpr auto keys() const noexcept -> std::span<const Key> {
+    return std::span<const Key>{m_columns.keys.data(), size()};
+  }
+  [[nodiscard]] constexpr auto values() noexcept -> std::span<Value> {
+    return std::span<Value>{m_columns.values.data(), size()};
+  }
+  [[nodiscard]] constexpr auto values() const noexcept -> std::span<const Value> {
+    return std::span<const Value>{m_columns.values.data(), size()};
+  }
+  [[nodiscard]] constexpr auto key_comp() const noexcept -> key_compare { return m_compare; }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return m_columns.keys.size(); }
+  [[nodiscard]] constexpr auto ssize() const noexcept -> difference_type {
+    return static_cast<difference_type>(size());
+  }
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return size() == 0UZ; }
+  [[nodiscard]] constexpr auto full() const noexcept -> bool { return size() == CAPACITY; }
+  [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return CAPACITY; }
+  [[nodiscard]] static constexpr auto max_size() noexcept -> size_type { return CAPACITY; }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto lower_bound(const Key& key) noexcept -> iterator {
+    return begin() + static_cast<difference_type>(lower_bound_index(key));
+  }
+  [[nodiscard]] constexpr auto lower_bound(const Key& key) const noexcept -> const_iterator {
+    return cbegin() + static_cast<difference_type>(lower_bound_index(key));
+  }
+  [[nodiscard]] constexpr auto find(const Key& key) noexcept -> iterator {
+    return begin() + static_cast<difference_type>(find_index(key));
+  }
+  [[nodiscard]] constexpr auto find(const Key& key) const noexcept -> const_iterator {
+    return cbegin() + static_cast<difference_type>(find_index(key));
+  }
+  [[nodiscard]] constexpr auto contains(const Key& key) const noexcept -> bool {
+    return find_index(key) != size();
+  }
+  [[nodiscard]] constexpr auto count(const Key& key) const noexcept -> size_type {
+    return contains(key) ? 1UZ : 0UZ;
+  }
+
+  // The value of `key`, which must be present.
+  [[nodiscard]] constexpr auto at(const Key& key) noexcept -> Value& {
+    const auto idx = find_index(key);
+    assert(idx != size() && "Key must be present.");
+    return m_columns.values[idx];
+  }
+  [[nodiscard]] constexpr auto at(const Key& key) const noexcept -> const Value& {
+    const auto idx = find_index(key);
+    assert(idx != size() && "Key must be present.");
+    return m_columns.values[idx];
+  }
+
+  // The value of `key`, which is value-initialized and inserted if `key` is not present.
+  constexpr auto operator[](const Key& key) noexcept -> Value& {
+    return std::get<1>(*try_emplace(key).first);
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Inserts `key` with a value constructed from `args` unless `key` is present, in which case
+  // `args` are left untouched. Returns the position of `key` and whether it was inserted.
+  template <typename... Args>
+  constexpr auto try_emplace(const Key& key, Args&&... args) noexcept -> std::pair<iterator, bool> {
+    return try_emplace_key(key, std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  constexpr auto try_emplace(Key&& key, Args&&... args) noexcept -> std::pair<iterator, bool> {
+    return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+  }
+
+  constexpr auto insert(const value_type& entry) noexcept -> std::pair<iterator, bool> {
+    return try_emplace(std::get<0>(entry), std::get<1>(entry));
+  }
+  constexpr auto insert(value_type&& entry) noexcept -> std::pair<iterator, bool> {
+    return try_emplace(std::get<0>(std::move(entry)), std::get<1>(std::move(entry)));
+  }
+
+  // Inserts `key` with `value`, or assigns `value` if `key` is present.
+  template <typename V>
+  constexpr auto insert_or_assign(const Key& key, V&& value) noexcept
+      -> std::pair<iterator, bool> {
+    const auto idx = lower_bound_index(key);
+    if (idx != size() && !m_compare(key, m_columns.keys[idx])) {
+      m_columns.values[idx] = std::forward<V>(value);
+      return {begin() + static_cast<difference_type>(idx), false};
+    }
+    return {emplace_at(idx, key, std::forward<V>(value)), true};
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Replaces the entries with `keys` and their `values`. The keys must be sorted by `Compare` and
+  // unique. Both columns are copied in bulk without searching for the positions of the keys.
+  constexpr void assign_sorted(std::span<const Key> keys, std::span<const Value> values) noexcept {
+    assert(keys.size() == values.size() && "Every key requires a value.");
+    assert(keys.size() <= CAPACITY && "Size may not exceed capacity.");
+    assert(std::ranges::adjacent_find(keys, std::not_fn(m_compare)) == keys.end() &&
+           "Keys must be sorted and unique.");
+    clear();
+    m_columns.keys.append(keys.data(), keys.size());
+    m_columns.values.append(values.data(), values.size());
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Removes the entry of `key`, returns the number of removed entries.
+  constexpr auto erase(const Key& key) noexcept -> size_type {
+    const auto idx = find_index(key);
+    if (idx == size()) { return 0UZ; }
+    erase_at(idx);
+    return 1UZ;
+  }
+  constexpr auto erase(const_iterator pos) noexcept -> iterator {
+    assert(pos != cend() && "Cannot erase end iterator.");
+    const auto idx = static_cast<size_type>(pos - cbegin());
+    erase_at(idx);
+    return begin() + static_cast<difference_type>(idx);
+  }
+  constexpr auto erase(iterator pos) noexcept -> iterator {
+    return erase(cbegin() + (pos - begin()));
+  }
+
+  constexpr void clear() noexcept {
+    m_columns.keys.clear();
+    m_columns.values.clear();
+  }
+
+ private:
+  [[nodiscard]] constexpr auto lower_bound_index(const Key& key) const noexcept -> size_type {
+    return detail::flat_lower_bound<CAPACITY>(m_columns.keys.data(), size(), key, m_compare);
+  }
+  [[nodiscard]] constexpr auto find_index(const Key& key) const noexcept -> size_type {
+    const auto idx = lower_bound_index(key);
+    return idx != size() && !m_compare(key, m_columns.keys[idx]) ? idx : size();
+  }
+
+  template <typename K, typename... Args>
+  constexpr auto try_emplace_key(K&& key, Args&&... args) noexcept -> std::pair<iterator, bool> {
+    const auto idx = lower_bound_index(key);
+    if (idx != size() && !m_compare(key, m_columns.keys[idx])) {
+      return {begin() + static_cast<difference_type>(idx), false};
+    }
+    return {emplace_at(idx, std::forward<K>(key), std::forward<Args>(args)...), true};
+  }
+
+  template <typename K, typename... Args>
+  constexpr auto emplace_at(size_type idx, K&& key, Args&&... args) noexcept -> iterator {
+    assert(!full() && "Size may not exceed capacity.");
+    m_columns.keys.emplace(m_columns.keys.begin() + idx, std::forward<K>(key));
+    m_columns.values.emplace(m_columns.values.begin() + idx, std::forward<Args>(args)...);
+    return begin() + static_cast<difference_type>(idx);
+  }
+
+  constexpr void erase_at(size_type idx) noexcept {
+    m_columns.keys.erase(m_columns.keys.begin() + idx);
+    m_columns.values.erase(m_columns.values.begin() + idx);
+  }
+};
+
+#endif  // STATIC_FLAT_MAP_HPP_
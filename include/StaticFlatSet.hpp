@@ -0,0 +1,166 @@
+#ifndef STATIC_FLAT_SET_HPP_
+#define STATIC_FLAT_SET_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <utility>
+
+#include "Algorithm.hpp"
+#include "Simd.hpp"
+#include "StaticVector.hpp"
+
+namespace detail {
+
+// -------------------------------------------------------------------------------------------------
+// Sorted tables that span at most this many registers are searched linearly: counting the keys
+// that compare before the searched key in all chunks at once beats the dependent loads of a binary
+// search up to about 128 32-bit keys.
+inline constexpr size_t MAX_LINEAR_SEARCH_CHUNKS = 8UZ;
+
+// Keys ordered by `<` or `>` that fit into a register lane.
+template <typename Compare, typename Key>
+concept SimdOrdering = simd::Vectorizable<Key> && ArithmeticOrdering<Compare, Key>;
+
+// Index of the first of the `size` keys sorted by `comp` that does not compare before `key`.
+// `keys` must point to the storage of a vector with capacity `CAPACITY`.
+template <size_t CAPACITY, typename Key, typename Compare>
+[[nodiscard]] constexpr auto flat_lower_bound(const Key* keys, size_t size, const Key& key,
+                                              const Compare& comp) noexcept -> size_t {
+  if constexpr (SimdOrdering<Compare, Key>) {
+    if !consteval {
+      // The keys that compare before `key` form a prefix, their number is the lower bound.
+      constexpr auto CMP        = simd_compare<Compare, Key>::value;
+      constexpr auto MAX_LINEAR = std::min(CAPACITY, MAX_LINEAR_SEARCH_CHUNKS * simd::LANES<Key>);
+      if (CAPACITY == MAX_LINEAR || size <= MAX_LINEAR) {
+        return simd::count<CMP, Key, MAX_LINEAR>(keys, size, key);
+      }
+    }
+  }
+
+  // Branchless binary search: the range halves every step and the compiler selects the next half
+  // with a conditional move, so the loop only depends on the size.
+  if (size == 0UZ) { return 0UZ; }
+  const Key* first = keys;
+  while (size > 1UZ) {
+    const auto half  = size / 2UZ;
+    first            = comp(first[half], key) ? first + half : first;
+    size            -= half;
+  }
+  return static_cast<size_t>(first - keys) + static_cast<size_t>(comp(*first, key));
+}
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Set of at most CAPACITY keys, stored sorted by `Compare` in a StaticVector. Small sets are
+// searched with a vectorized linear scan, larger ones with a branchless binary search. Inserting
+// and erasing shift the keys behind the position, which is a memmove for trivially relocatable
+// keys.
+template <typename Key, size_t CAPACITY, typename Compare = std::less<Key>>
+class StaticFlatSet {
+  static_assert(CAPACITY > 0UZ, "StaticFlatSet requires a capacity greater than zero.");
+
+  StaticVector<Key, CAPACITY> m_keys;
+  [[no_unique_address]] Compare m_compare;
+
+ public:
+  using key_type        = Key;
+  using value_type      = Key;
+  using key_compare     = Compare;
+  using size_type       = size_t;
+  using difference_type = ssize_t;
+  using reference       = const value_type&;
+  using const_reference = const value_type&;
+  using iterator        = const value_type*;
+  using const_iterator  = const value_type*;
+
+  constexpr StaticFlatSet() noexcept = default;
+  constexpr StaticFlatSet(std::initializer_list<Key> keys) noexcept {
+    assert(keys.size() <= CAPACITY && "Size may not exceed capacity.");
+    for (const auto& key : keys) {
+      insert(key);
+    }
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return m_keys.begin(); }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return m_keys.end(); }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return m_keys.begin(); }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return m_keys.end(); }
+
+  [[nodiscard]] constexpr auto keys() const noexcept -> std::span<const Key> {
+    return std::span<const Key>{m_keys.data(), m_keys.size()};
+  }
+  [[nodiscard]] constexpr auto key_comp() const noexcept -> key_compare { return m_compare; }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return m_keys.size(); }
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return m_keys.empty(); }
+  [[nodiscard]] constexpr auto full() const noexcept -> bool { return size() == CAPACITY; }
+  [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return CAPACITY; }
+  [[nodiscard]] static constexpr auto max_size() noexcept -> size_type { return CAPACITY; }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto lower_bound(const Key& key) const noexcept -> const_iterator {
+    return begin() + detail::flat_lower_bound<CAPACITY>(m_keys.data(), size(), key, m_compare);
+  }
+  [[nodiscard]] constexpr auto find(const Key& key) const noexcept -> const_iterator {
+    const auto it = lower_bound(key);
+    return it != end() && !m_compare(key, *it) ? it : end();
+  }
+  [[nodiscard]] constexpr auto contains(const Key& key) const noexcept -> bool {
+    return find(key) != end();
+  }
+  [[nodiscard]] constexpr auto count(const Key& key) const noexcept -> size_type {
+    return contains(key) ? 1UZ : 0UZ;
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Inserts `key` unless an equivalent key is present. Returns the position of the key and whether
+  // it was inserted.
+  constexpr auto insert(const Key& key) noexcept -> std::pair<iterator, bool> {
+    return emplace(key);
+  }
+  constexpr auto insert(Key&& key) noexcept -> std::pair<iterator, bool> {
+    return emplace(std::move(key));
+  }
+
+  template <typename... Args>
+  constexpr auto emplace(Args&&... args) noexcept -> std::pair<iterator, bool> {
+    Key key(std::forward<Args>(args)...);
+    const auto it = lower_bound(key);
+    if (it != end() && !m_compare(key, *it)) { return {it, false}; }
+
+    assert(!full() && "Size may not exceed capacity.");
+    return {m_keys.insert(it, std::move(key)), true};
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Replaces the keys with `keys`, which must be sorted by `Compare` and unique. The keys are
+  // copied in bulk without searching for their positions.
+  constexpr void assign_sorted(std::span<const Key> keys) noexcept {
+    assert(keys.size() <= CAPACITY && "Size may not exceed capacity.");
+    assert(std::ranges::adjacent_find(keys, std::not_fn(m_compare)) == keys.end() &&
+           "Keys must be sorted and unique.");
+    m_keys.clear();
+    m_keys.append(keys.data(), keys.size());
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Removes the key equivalent to `key`, returns the number of removed keys.
+  constexpr auto erase(const Key& key) noexcept -> size_type {
+    const auto it = find(key);
+    if (it == end()) { return 0UZ; }
+    m_keys.erase(it);
+    return 1UZ;
+  }
+  constexpr auto erase(const_iterator pos) noexcept -> iterator { return m_keys.erase(pos); }
+
+  constexpr void clear() noexcept { m_keys.clear(); }
+};
+
+#endif  // STATIC_FLAT_SET_HPP_
@@ -0,0 +1,414 @@
+#ifndef STATIC_JAGGED_ARRAY_HPP_
+#define STATIC_JAGGED_ARRAY_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "StaticVector.hpp"
+#include "UninitializedArray.hpp"
+
+namespace detail {
+
+// =================================================================================================
+// Random access iterator over the rows of a jagged array, which yields a span per row. Row `r`
+// holds the elements [offsets[r], offsets[r + 1]).
+template <typename Element, typename Offset>
+class JaggedRowIterator {
+  Element* m_elements     = nullptr;
+  const Offset* m_offsets = nullptr;
+
+ public:
+  using iterator_concept  = std::random_access_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+  using difference_type   = ssize_t;
+  using value_type        = std::span<Element>;
+  using reference         = std::span<Element>;
+
+  constexpr JaggedRowIterator() noexcept = default;
+  constexpr JaggedRowIterator(Element* elements, const Offset* offsets) noexcept
+      : m_elements(elements),
+        m_offsets(offsets) {}
+
+  // Mutable iterators convert to const iterators.
+  constexpr operator JaggedRowIterator<const Element, Offset>() const noexcept
+  requires(!std::is_const_v<Element>)
+  {
+    return JaggedRowIterator<const Element, Offset>{m_elements, m_offsets};
+  }
+
+  constexpr auto operator==(const JaggedRowIterator& other) const noexcept -> bool {
+    return m_offsets == other.m_offsets;
+  }
+  constexpr auto operator<=>(const JaggedRowIterator& other) const noexcept
+      -> std::strong_ordering {
+    return m_offsets <=> other.m_offsets;
+  }
+
+  constexpr auto operator*() const noexcept -> reference {
+    return reference{m_elements + m_offsets[0], m_elements + m_offsets[1]};
+  }
+  constexpr auto operator[](difference_type offset) const noexcept -> reference {
+    return *(*this + offset);
+  }
+
+  constexpr auto operator++() noexcept -> JaggedRowIterator& {
+    ++m_offsets;
+    return *this;
+  }
+  constexpr auto operator++(int) noexcept -> JaggedRowIterator {
+    const auto res = *this;
+    ++m_offsets;
+    return res;
+  }
+  constexpr auto operator--() noexcept -> JaggedRowIterator& {
+    --m_offsets;
+    return *this;
+  }
+  constexpr auto operator--(int) noexcept -> JaggedRowIterator {
+    const auto res = *this;
+    --m_offsets;
+    return res;
+  }
+
+  constexpr auto operator+=(difference_type offset) noexcept -> JaggedRowIterator& {
+    m_offsets += offset;
+    return *this;
+  }
+  constexpr auto operator-=(difference_type offset) noexcept -> JaggedRowIterator& {
+    m_offsets -= offset;
+    return *this;
+  }
+  constexpr auto operator+(difference_type offset) const noexcept -> JaggedRowIterator {
+    return JaggedRowIterator{m_elements, m_offsets + offset};
+  }
+  constexpr auto operator-(difference_type offset) const noexcept -> JaggedRowIterator {
+    return JaggedRowIterator{m_elements, m_offsets - offset};
+  }
+  friend constexpr auto operator+(difference_type offset, const JaggedRowIterator& it) noexcept
+      -> JaggedRowIterator {
+    return it + offset;
+  }
+  constexpr auto operator-(const JaggedRowIterator& other) const noexcept -> difference_type {
+    return m_offsets - other.m_offsets;
+  }
+};
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Up to MAX_ROWS rows of elements, with at most TOTAL_CAPACITY elements over all rows. The rows are
+// stored back to back in one buffer, in the order they were appended, with a table of the offsets
+// at which they start (compressed sparse rows). Unlike an array of StaticVectors, short rows waste
+// no capacity, but only the last row can grow or shrink.
+//
+// Rows are spans, such that they offer the read API of StaticVector. Elements can be modified in
+// place. Appending rows or elements invalidates no row, popping the last row invalidates it.
+template <typename Element, size_t MAX_ROWS, size_t TOTAL_CAPACITY>
+class StaticJaggedVector {
+  static_assert(MAX_ROWS > 0UZ, "StaticJaggedVector requires at least one row.");
+  static_assert(TOTAL_CAPACITY > 0UZ, "StaticJaggedVector requires a capacity greater than zero.");
+
+  using Offset = detail::SizeType<TOTAL_CAPACITY>;
+
+  detail::UninitializedArray<Element, TOTAL_CAPACITY> m_elements;
+  std::array<Offset, MAX_ROWS + 1UZ> m_offsets{};
+  detail::SizeType<MAX_ROWS> m_rows = 0U;
+
+ public:
+  using value_type             = std::span<Element>;
+  using element_type           = Element;
+  using size_type              = size_t;
+  using difference_type        = ssize_t;
+  using reference              = std::span<Element>;
+  using const_reference        = std::span<const Element>;
+  using iterator               = detail::JaggedRowIterator<Element, Offset>;
+  using const_iterator         = detail::JaggedRowIterator<const Element, Offset>;
+  using reverse_iterator       = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  constexpr StaticJaggedVector() noexcept = default;
+  constexpr StaticJaggedVector(
+      std::initializer_list<std::initializer_list<Element>> rows) noexcept {
+    for (const auto& row : rows) {
+      push_row(row);
+    }
+  }
+
+  // - Copy / move ---------------------------------------------------------------------------------
+  constexpr StaticJaggedVector(const StaticJaggedVector& other) noexcept
+      : m_offsets(other.m_offsets),
+        m_rows(other.m_rows) {
+    detail::copy_construct(m_elements.data(), other.m_elements.data(), other.total_size());
+  }
+  constexpr StaticJaggedVector(StaticJaggedVector&& other) noexcept
+      : m_offsets(other.m_offsets),
+        m_rows(other.m_rows) {
+    detail::uninitialized_move(other.m_elements.data(),
+                               other.m_elements.data() + other.total_size(),
+                               m_elements.data());
+  }
+
+  constexpr auto operator=(const StaticJaggedVector& other) noexcept -> StaticJaggedVector& {
+    if (this != &other) {
+      destroy_elements(0UZ);
+      m_offsets = other.m_offsets;
+      m_rows    = other.m_rows;
+      detail::copy_construct(m_elements.data(), other.m_elements.data(), other.total_size());
+    }
+    return *this;
+  }
+  constexpr auto operator=(StaticJaggedVector&& other) noexcept -> StaticJaggedVector& {
+    if (this != &other) {
+      destroy_elements(0UZ);
+      m_offsets = other.m_offsets;
+      m_rows    = other.m_rows;
+      detail::uninitialized_move(other.m_elements.data(),
+                                 other.m_elements.data() + other.total_size(),
+                                 m_elements.data());
+    }
+    return *this;
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  constexpr ~StaticJaggedVector() noexcept = default;
+  constexpr ~StaticJaggedVector() noexcept
+  requires(!std::is_trivially_destructible_v<Element>)
+  {
+    destroy_elements(0UZ);
+  }
+
+  [[nodiscard]] constexpr auto operator==(const StaticJaggedVector& other) const noexcept -> bool {
+    return std::ranges::equal(*this, other, std::ranges::equal);
+  }
+
+  // - Rows ----------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return m_rows == 0U; }
+  [[nodiscard]] constexpr auto full() const noexcept -> bool { return m_rows == MAX_ROWS; }
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return m_rows; }
+  [[nodiscard]] static constexpr auto max_size() noexcept -> size_type { return MAX_ROWS; }
+  [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return MAX_ROWS; }
+
+  [[nodiscard]] constexpr auto operator[](size_type row) noexcept -> reference {
+    assert(row < size() && "Index out of bounds.");
+    return begin()[static_cast<difference_type>(row)];
+  }
+  [[nodiscard]] constexpr auto operator[](size_type row) const noexcept -> const_reference {
+    assert(row < size() && "Index out of bounds.");
+    return begin()[static_cast<difference_type>(row)];
+  }
+  [[nodiscard]] constexpr auto front() noexcept -> reference { return operator[](0UZ); }
+  [[nodiscard]] constexpr auto front() const noexcept -> const_reference {
+    return operator[](0UZ);
+  }
+  [[nodiscard]] constexpr auto back() noexcept -> reference { return operator[](size() - 1UZ); }
+  [[nodiscard]] constexpr auto back() const noexcept -> const_reference {
+    return operator[](size() - 1UZ);
+  }
+
+  // - Elements of all rows ------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto total_size() const noexcept -> size_type {
+    return m_offsets[m_rows];
+  }
+  [[nodiscard]] static constexpr auto total_capacity() noexcept -> size_type {
+    return TOTAL_CAPACITY;
+  }
+  [[nodiscard]] constexpr auto elements() noexcept -> std::span<Element> {
+    return std::span<Element>{m_elements.data(), total_size()};
+  }
+  [[nodiscard]] constexpr auto elements() const noexcept -> std::span<const Element> {
+    return std::span<const Element>{m_elements.data(), total_size()};
+  }
+  // The `size() + 1` offsets at which the rows start, followed by the total size.
+  [[nodiscard]] constexpr auto offsets() const noexcept -> std::span<const Offset> {
+    return std::span<const Offset>{m_offsets.data(), size() + 1UZ};
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator {
+    return iterator{m_elements.data(), m_offsets.data()};
+  }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+    return const_iterator{m_elements.data(), m_offsets.data()};
+  }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator { return begin() + size(); }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return begin() + size(); }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+  [[nodiscard]] constexpr auto rbegin() noexcept -> reverse_iterator {
+    return reverse_iterator{end()};
+  }
+  [[nodiscard]] constexpr auto rbegin() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{end()};
+  }
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> const_reverse_iterator {
+    return rbegin();
+  }
+  [[nodiscard]] constexpr auto rend() noexcept -> reverse_iterator {
+    return reverse_iterator{begin()};
+  }
+  [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator {
+    return const_reverse_iterator{begin()};
+  }
+  [[nodiscard]] constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+
+  // - Building ------------------------------------------------------------------------------------
+  // Appends an empty row, which `push_back` and `emplace_back` append elements to.
+  constexpr void push_row() noexcept {
+    assert(m_rows < MAX_ROWS && "Number of rows may not exceed the maximum.");
+    m_offsets[m_rows + 1U] = m_offsets[m_rows];
+    ++m_rows;
+  }
+  // Appends a row with the elements of `range`.
+  template <detail::ContainerCompatibleRange<Element> Range>
+  constexpr void push_row(Range&& range) noexcept {
+    push_row();
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>) {
+      const auto count = static_cast<size_type>(std::ranges::distance(range));
+      assert(total_size() + count <= TOTAL_CAPACITY && "Size may not exceed capacity.");
+      detail::copy_construct(m_elements.data() + total_size(), std::ranges::begin(range), count);
+      m_offsets[m_rows] = static_cast<Offset>(total_size() + count);
+    } else {
+      for (auto&& e : range) {
+        emplace_back(std::forward<decltype(e)>(e));
+      }
+    }
+  }
+  constexpr void push_row(std::initializer_list<Element> values) noexcept {
+    push_row(std::span<const Element>{values.begin(), values.size()});
+  }
+
+  // Appends an element to the last row.
+  template <typename... Args>
+  constexpr auto emplace_back(Args&&... args) noexcept -> Element& {
+    assert(!empty() && "Elements can only be appended to an existing row.");
+    assert(total_size() < TOTAL_CAPACITY && "Size may not exceed capacity.");
+    Element* e = std::construct_at(m_elements.data() + total_size(), std::forward<Args>(args)...);
+    ++m_offsets[m_rows];
+    return *e;
+  }
+  constexpr void push_back(const Element& e) noexcept { emplace_back(e); }
+  constexpr void push_back(Element&& e) noexcept { emplace_back(std::move(e)); }
+
+  // Removes the last row with its elements.
+  constexpr void pop_row() noexcept {
+    assert(!empty() && "Vector cannot be empty.");
+    destroy_elements(m_offsets[m_rows - 1U]);
+    --m_rows;
+  }
+
+  constexpr void clear() noexcept {
+    destroy_elements(0UZ);
+    m_rows = 0U;
+  }
+
+ private:
+  // Destroys the elements from `first` to the end of the last row.
+  constexpr void destroy_elements(size_type first) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<Element>) {
+      std::destroy(m_elements.data() + first, m_elements.data() + total_size());
+    }
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+// Exactly ROWS rows with at most TOTAL_CAPACITY elements over all rows, stored like in
+// StaticJaggedVector, which also builds the array row by row. Rows that were not built are empty.
+//
+//   StaticJaggedArray<uint32_t, 3, 8>::Builder builder;
+//   builder.push_row({1, 2});
+//   builder.push_row();
+//   builder.push_back(0);
+//   StaticJaggedArray<uint32_t, 3, 8> adjacency{std::move(builder)};  // {{1, 2}, {0}, {}}
+template <typename Element, size_t ROWS, size_t TOTAL_CAPACITY>
+class StaticJaggedArray {
+ public:
+  using Builder = StaticJaggedVector<Element, ROWS, TOTAL_CAPACITY>;
+
+ private:
+  Builder m_rows;
+
+ public:
+  using value_type             = typename Builder::value_type;
+  using element_type           = Element;
+  using size_type              = size_t;
+  using difference_type        = ssize_t;
+  using reference              = typename Builder::reference;
+  using const_reference        = typename Builder::const_reference;
+  using iterator               = typename Builder::iterator;
+  using const_iterator         = typename Builder::const_iterator;
+  using reverse_iterator       = typename Builder::reverse_iterator;
+  using const_reverse_iterator = typename Builder::const_reverse_iterator;
+
+  constexpr StaticJaggedArray() noexcept : StaticJaggedArray(Builder{}) {}
+  constexpr explicit StaticJaggedArray(Builder rows) noexcept
+      : m_rows(std::move(rows)) {
+    while (!m_rows.full()) {
+      m_rows.push_row();
+    }
+  }
+  constexpr StaticJaggedArray(std::initializer_list<std::initializer_list<Element>> rows) noexcept
+      : StaticJaggedArray(Builder(rows)) {}
+
+  [[nodiscard]] constexpr auto operator==(const StaticJaggedArray&) const noexcept -> bool =
+      default;
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] static constexpr auto empty() noexcept -> bool { return false; }
+  [[nodiscard]] static constexpr auto size() noexcept -> size_type { return ROWS; }
+  [[nodiscard]] static constexpr auto max_size() noexcept -> size_type { return ROWS; }
+
+  [[nodiscard]] constexpr auto operator[](size_type row) noexcept -> reference {
+    return m_rows[row];
+  }
+  [[nodiscard]] constexpr auto operator[](size_type row) const noexcept -> const_reference {
+    return m_rows[row];
+  }
+  [[nodiscard]] constexpr auto front() noexcept -> reference { return m_rows.front(); }
+  [[nodiscard]] constexpr auto front() const noexcept -> const_reference { return m_rows.front(); }
+  [[nodiscard]] constexpr auto back() noexcept -> reference { return m_rows.back(); }
+  [[nodiscard]] constexpr auto back() const noexcept -> const_reference { return m_rows.back(); }
+
+  [[nodiscard]] constexpr auto total_size() const noexcept -> size_type {
+    return m_rows.total_size();
+  }
+  [[nodiscard]] static constexpr auto total_capacity() noexcept -> size_type {
+    return TOTAL_CAPACITY;
+  }
+  [[nodiscard]] constexpr auto elements() noexcept { return m_rows.elements(); }
+  [[nodiscard]] constexpr auto elements() const noexcept { return m_rows.elements(); }
+  [[nodiscard]] constexpr auto offsets() const noexcept { return m_rows.offsets(); }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator { return m_rows.begin(); }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return m_rows.begin(); }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator { return m_rows.end(); }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return m_rows.end(); }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+  [[nodiscard]] constexpr auto rbegin() noexcept -> reverse_iterator { return m_rows.rbegin(); }
+  [[nodiscard]] constexpr auto rbegin() const noexcept -> const_reverse_iterator {
+    return m_rows.rbegin();
+  }
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> const_reverse_iterator {
+    return rbegin();
+  }
+  [[nodiscard]] constexpr auto rend() noexcept -> reverse_iterator { return m_rows.rend(); }
+  [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator {
+    return m_rows.rend();
+  }
+  [[nodiscard]] constexpr auto crend() const noexcept -> const_reverse_iterator { return rend(); }
+};
+
+#endif  // STATIC_JAGGED_ARRAY_HPP_
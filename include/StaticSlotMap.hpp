@@ -0,0 +1,241 @@
+#ifndef STATIC_SLOT_MAP_HPP_
+#define STATIC_SLOT_MAP_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "StaticVector.hpp"
+#include "UninitializedArray.hpp"
+
+// -------------------------------------------------------------------------------------------------
+// Pool of at most CAPACITY elements that are addressed by handles, which stay valid until their
+// element is erased. The elements are packed at the front of a dense array, such that iterating
+// over them touches no gaps; erasing moves the last element into the gap, so the iteration order
+// changes.
+//
+// A handle names a slot and the generation of the slot when the element was inserted. Every insert
+// and erase increments the generation of its slot, so occupied slots have odd generations and a
+// handle is stale once its generation differs from the generation of its slot. Free slots form a
+// list threaded through the slots, slots that were never used are handed out behind them. A handle
+// only becomes valid again after 2^32 inserts and erases into the same slot.
+template <typename Element, size_t CAPACITY>
+class StaticSlotMap {
+  static_assert(CAPACITY > 0UZ, "StaticSlotMap requires a capacity greater than zero.");
+  static_assert(CAPACITY < UINT32_MAX, "Slot indices must fit into 32 bits.");
+
+  using Index = detail::SizeType<CAPACITY>;
+
+  // Index of the element of an occupied slot, or the next free slot of a free one.
+  struct Slot {
+    std::uint32_t generation;
+    Index index;
+  };
+
+  static constexpr Index NO_SLOT = CAPACITY;
+
+  detail::UninitializedArray<Element, CAPACITY> m_elements;
+  detail::UninitializedArray<Index, CAPACITY> m_element_slots;
+  detail::UninitializedArray<Slot, CAPACITY> m_slots;
+  Index m_size       = 0U;
+  Index m_used_slots = 0U;
+  Index m_free_slot  = NO_SLOT;
+
+ public:
+  struct Handle {
+    std::uint32_t index      = 0U;
+    std::uint32_t generation = 0U;  // Even generations never match, the default handle is null.
+
+    constexpr auto operator==(const Handle&) const noexcept -> bool = default;
+  };
+
+  using value_type      = Element;
+  using size_type       = size_t;
+  using difference_type = ssize_t;
+  using reference       = value_type&;
+  using const_reference = const value_type&;
+  using pointer         = value_type*;
+  using const_pointer   = const value_type*;
+  using iterator        = pointer;
+  using const_iterator  = const_pointer;
+  using handle_type     = Handle;
+
+  constexpr StaticSlotMap() noexcept = default;
+
+  // - Copy / move ---------------------------------------------------------------------------------
+  // Handles of `other` are valid for the new map as well.
+  constexpr StaticSlotMap(const StaticSlotMap& other) noexcept {
+    copy_slots(other);
+    detail::copy_construct(m_elements.data(), other.m_elements.data(), other.m_size);
+  }
+  constexpr StaticSlotMap(StaticSlotMap&& other) noexcept {
+    copy_slots(other);
+    detail::uninitialized_move(
+        other.m_elements.data(), other.m_elements.data() + other.m_size, m_elements.data());
+  }
+
+  constexpr auto operator=(const StaticSlotMap& other) noexcept -> StaticSlotMap& {
+    if (this != &other) {
+      destroy_elements();
+      copy_slots(other);
+      detail::copy_construct(m_elements.data(), other.m_elements.data(), other.m_size);
+    }
+    return *this;
+  }
+  constexpr auto operator=(StaticSlotMap&& other) noexcept -> StaticSlotMap& {
+    if (this != &other) {
+      destroy_elements();
+      copy_slots(other);
+      detail::uninitialized_move(
+          other.m_elements.data(), other.m_elements.data() + other.m_size, m_elements.data());
+    }
+    return *this;
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  constexpr ~StaticSlotMap() noexcept = default;
+  constexpr ~StaticSlotMap() noexcept
+  requires(!std::is_trivially_destructible_v<Element>)
+  {
+    destroy_elements();
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return m_size == 0U; }
+  [[nodiscard]] constexpr auto full() const noexcept -> bool { return m_size == CAPACITY; }
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] static constexpr auto capacity() noexcept -> size_type { return CAPACITY; }
+  [[nodiscard]] static constexpr auto max_size() noexcept -> size_type { return CAPACITY; }
+
+  // - Dense elements ------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto data() noexcept -> pointer { return m_elements.data(); }
+  [[nodiscard]] constexpr auto data() const noexcept -> const_pointer { return m_elements.data(); }
+  [[nodiscard]] constexpr auto values() noexcept -> std::span<Element> {
+    return std::span<Element>{data(), size()};
+  }
+  [[nodiscard]] constexpr auto values() const noexcept -> std::span<const Element> {
+    return std::span<const Element>{data(), size()};
+  }
+
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator { return data(); }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return data(); }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return data(); }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator { return data() + size(); }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return data() + size(); }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+  // Handle of the element at position `idx` of the dense array.
+  [[nodiscard]] constexpr auto handle_at(size_type idx) const noexcept -> Handle {
+    assert(idx < size() && "Index out of bounds.");
+    const auto slot = m_element_slots.data()[idx];
+    return Handle{.index = slot, .generation = m_slots.data()[slot].generation};
+  }
+
+  // - Lookup --------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto contains(Handle handle) const noexcept -> bool {
+    return handle.index < m_used_slots && (handle.generation & 1U) != 0U &&
+           m_slots.data()[handle.index].generation == handle.generation;
+  }
+
+  // The element of `handle`, or nullptr if the handle is stale.
+  [[nodiscard]] constexpr auto find(Handle handle) noexcept -> pointer {
+    return contains(handle) ? data() + m_slots.data()[handle.index].index : nullptr;
+  }
+  [[nodiscard]] constexpr auto find(Handle handle) const noexcept -> const_pointer {
+    return contains(handle) ? data() + m_slots.data()[handle.index].index : nullptr;
+  }
+
+  [[nodiscard]] constexpr auto operator[](Handle handle) noexcept -> reference {
+    assert(contains(handle) && "Handle must refer to an element of the map.");
+    return data()[m_slots.data()[handle.index].index];
+  }
+  [[nodiscard]] constexpr auto operator[](Handle handle) const noexcept -> const_reference {
+    assert(contains(handle) && "Handle must refer to an element of the map.");
+    return data()[m_slots.data()[handle.index].index];
+  }
+
+  // - Insert --------------------------------------------------------------------------------------
+  constexpr auto insert(const Element& e) noexcept -> Handle { return emplace(e); }
+  constexpr auto insert(Element&& e) noexcept -> Handle { return emplace(std::move(e)); }
+
+  // Constructs an element in the most recently freed slot, or in an unused one.
+  template <typename... Args>
+  constexpr auto emplace(Args&&... args) noexcept -> Handle {
+    assert(!full() && "Size may not exceed capacity.");
+    Index slot_idx = m_free_slot;
+    if (slot_idx != NO_SLOT) {
+      m_free_slot = m_slots.data()[slot_idx].index;
+    } else {
+      slot_idx = m_used_slots++;
+      std::construct_at(m_slots.data() + slot_idx, Slot{.generation = 0U, .index = NO_SLOT});
+    }
+
+    Slot& slot = m_slots.data()[slot_idx];
+    ++slot.generation;
+    slot.index = m_size;
+    std::construct_at(m_elements.data() + m_size, std::forward<Args>(args)...);
+    m_element_slots.data()[m_size] = slot_idx;
+    ++m_size;
+    return Handle{.index = slot_idx, .generation = slot.generation};
+  }
+
+  // - Erase ---------------------------------------------------------------------------------------
+  // Destroys the element of `handle` and moves the last element into its place. Returns false if
+  // the handle is stale.
+  constexpr auto erase(Handle handle) noexcept -> bool {
+    if (!contains(handle)) { return false; }
+
+    Slot& slot          = m_slots.data()[handle.index];
+    const auto idx      = slot.index;
+    const auto last     = static_cast<Index>(m_size - 1U);
+    Element* elements   = m_elements.data();
+    Index* element_slot = m_element_slots.data();
+    if (idx != last) {
+      elements[idx]                           = std::move(elements[last]);
+      element_slot[idx]                       = element_slot[last];
+      m_slots.data()[element_slot[idx]].index = idx;
+    }
+    std::destroy_at(elements + last);
+    --m_size;
+
+    ++slot.generation;
+    slot.index  = m_free_slot;
+    m_free_slot = static_cast<Index>(handle.index);
+    return true;
+  }
+
+  // Erases all elements, every handle becomes stale.
+  constexpr void clear() noexcept {
+    for (Index idx = 0U; idx < m_size; ++idx) {
+      const auto slot_idx = m_element_slots.data()[idx];
+      Slot& slot          = m_slots.data()[slot_idx];
+      ++slot.generation;
+      slot.index  = m_free_slot;
+      m_free_slot = slot_idx;
+    }
+    destroy_elements();
+    m_size = 0U;
+  }
+
+ private:
+  constexpr void destroy_elements() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<Element>) {
+      std::destroy(m_elements.data(), m_elements.data() + m_size);
+    }
+  }
+
+  // Takes over the slots and the size of `other`; the elements are constructed by the caller.
+  constexpr void copy_slots(const StaticSlotMap& other) noexcept {
+    detail::copy_construct(m_slots.data(), other.m_slots.data(), other.m_used_slots);
+    detail::copy_construct(m_element_slots.data(), other.m_element_slots.data(), other.m_size);
+    m_size       = other.m_size;
+    m_used_slots = other.m_used_slots;
+    m_free_slot  = other.m_free_slot;
+  }
+};
+
+#endif  // STATIC_SLOT_MAP_HPP_
@@ -0,0 +1,394 @@
+#ifndef STATIC_SOA_VECTOR_HPP_
+#define STATIC_SOA_VECTOR_HPP_
+
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "StaticVector.hpp"
+#include "UninitializedArray.hpp"
+
+namespace detail {
+
+// -------------------------------------------------------------------------------------------------
+// One uninitialized array per field. The columns are plain members of distinct bases, such that
+// default construction leaves them uninitialized like the storage of StaticVector; a std::tuple
+// would value-initialize all of them.
+template <size_t I, typename Field, size_t CAPACITY>
+struct SoAColumn {
+  UninitializedArray<Field, CAPACITY> m_storage;
+};
+
+template <size_t CAPACITY, typename Indices, typename... Fields>
+struct SoAColumns;
+
+template <size_t CAPACITY, size_t... Is, typename... Fields>
+struct SoAColumns<CAPACITY, std::index_sequence<Is...>, Fields...>
+    : SoAColumn<Is, Fields, CAPACITY>... {
+  template <size_t I>
+  using Field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+  template <size_t I>
+  [[nodiscard]] constexpr auto data() noexcept -> Field<I>* {
+    return static_cast<SoAColumn<I, Field<I>, CAPACITY>&>(*this).m_storage.data();
+  }
+  template <size_t I>
+  [[nodiscard]] constexpr auto data() const noexcept -> const Field<I>* {
+    return static_cast<const SoAColumn<I, Field<I>, CAPACITY>&>(*this).m_storage.data();
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+// Row of a StaticSoAVector: a tuple of references into the columns. It is a distinct type to
+// provide the common reference with the value tuple, which the standard library does not define
+// for tuples before C++23's zip. This makes the iterators proper random access iterators.
+template <typename... Refs>
+struct SoARow : std::tuple<Refs...> {
+  using std::tuple<Refs...>::tuple;
+  using std::tuple<Refs...>::operator=;
+
+  // Binds the references to the fields of a value tuple.
+  template <typename Values>
+    requires(std::is_lvalue_reference_v<Values> &&
+             std::tuple_size_v<std::remove_cvref_t<Values>> == sizeof...(Refs))
+  constexpr SoARow(Values&& values) noexcept
+      : std::tuple<Refs...>(std::apply(
+            [](auto&... fields) { return std::tuple<Refs...>(fields...); }, values)) {}
+};
+
+}  // namespace detail
+
+template <typename... Refs>
+struct std::tuple_size<detail::SoARow<Refs...>>
+    : std::integral_constant<size_t, sizeof...(Refs)> {};
+
+template <size_t I, typename... Refs>
+struct std::tuple_element<I, detail::SoARow<Refs...>> : std::tuple_element<I, std::tuple<Refs...>> {
+};
+
+template <typename... Refs, typename... Values, template <typename> typename RefQual,
+          template <typename> typename ValueQual>
+  requires(sizeof...(Refs) == sizeof...(Values))
+struct std::basic_common_reference<detail::SoARow<Refs...>, std::tuple<Values...>, RefQual,
+                                   ValueQual> {
+  using type = detail::SoARow<std::common_reference_t<Refs, ValueQual<Values>>...>;
+};
+
+template <typename... Values, typename... Refs, template <typename> typename ValueQual,
+          template <typename> typename RefQual>
+  requires(sizeof...(Refs) == sizeof...(Values))
+struct std::basic_common_reference<std::tuple<Values...>, detail::SoARow<Refs...>, ValueQual,
+                                   RefQual> {
+  using type = detail::SoARow<std::common_reference_t<Refs, ValueQual<Values>>...>;
+};
+
+namespace detail {
+
+// =================================================================================================
+// Random access iterator over the rows of a StaticSoAVector. Dereferencing yields a row of
+// references into the columns instead of a reference to a stored tuple.
+template <typename Columns, typename... Fields>
+class SoAIterator {
+  Columns* m_columns = nullptr;
+  ssize_t m_idx      = 0;
+
+  template <size_t... Is>
+  [[nodiscard]] constexpr auto make_row(std::index_sequence<Is...> /*indices*/) const noexcept
+      -> SoARow<Fields&...> {
+    return SoARow<Fields&...>{m_columns->template data<Is>()[m_idx]...};
+  }
+
+ public:
+  using iterator_concept  = std::random_access_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
+  using difference_type   = ssize_t;
+  using value_type        = std::tuple<std::remove_const_t<Fields>...>;
+  using reference         = SoARow<Fields&...>;
+
+  constexpr SoAIterator() noexcept = default;
+  constexpr SoAIterator(Columns* columns, ssize_t idx) noexcept
+      : m_columns(columns),
+        m_idx(idx) {}
+
+  constexpr auto operator==(const SoAIterator& other) const noexcept -> bool {
+    assert(m_columns == other.m_columns && "Iterators must belong to the same vector.");
+    return m_idx == other.m_idx;
+  }
+  constexpr auto operator<=>(const SoAIterator& other) const noexcept -> std::strong_ordering {
+    assert(m_columns == other.m_columns && "Iterators must belong to the same vector.");
+    return m_idx <=> other.m_idx;
+  }
+
+  constexpr auto operator*() const noexcept -> reference {
+    assert(m_columns != nullptr && "SoAIterator must belong to a vector.");
+    return make_row(std::index_sequence_for<Fields...>{});
+  }
+  constexpr auto operator[](difference_type offset) const noexcept -> reference {
+    return *(*this + offset);
+  }
+
+  constexpr auto operator++() noexcept -> SoAIterator& {
+    m_idx += 1;
+    return *this;
+  }
+  constexpr auto operator++(int) noexcept -> SoAIterator {
+    const auto res  = *this;
+    m_idx          += 1;
+    return res;
+  }
+  constexpr auto operator--() noexcept -> SoAIterator& {
+    m_idx -= 1;
+    return *this;
+  }
+  constexpr auto operator--(int) noexcept -> SoAIterator {
+    const auto res  = *this;
+    m_idx          -= 1;
+    return res;
+  }
+
+  constexpr auto operator+=(difference_type offset) noexcept -> SoAIterator& {
+    m_idx += offset;
+    return *this;
+  }
+  constexpr auto operator-=(difference_type offset) noexcept -> SoAIterator& {
+    m_idx -= offset;
+    return *this;
+  }
+  constexpr auto operator+(difference_type offset) const noexcept -> SoAIterator {
+    return SoAIterator{m_columns, m_idx + offset};
+  }
+  constexpr auto operator-(difference_type offset) const noexcept -> SoAIterator {
+    return SoAIterator{m_columns, m_idx - offset};
+  }
+  friend constexpr auto operator+(difference_type offset, const SoAIterator& it) noexcept
+      -> SoAIterator {
+    return it + offset;
+  }
+  constexpr auto operator-(const SoAIterator& other) const noexcept -> difference_type {
+    assert(m_columns == other.m_columns && "Iterators must belong to the same vector.");
+    return m_idx - other.m_idx;
+  }
+};
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// Stores the fields of `std::tuple<Fields...>` in one array per field (structure of arrays), such
+// that a loop over a single field only loads that field. Rows are accessed as tuples of references,
+// single fields through `column<I>()`.
+template <typename Row, size_t CAPACITY>
+class StaticSoAVector;
+
+template <typename... Fields, size_t CAPACITY>
+class StaticSoAVector<std::tuple<Fields...>, CAPACITY> {
+  static_assert(sizeof...(Fields) > 0UZ, "StaticSoAVector requires at least one field.");
+  static_assert(CAPACITY > 0UZ, "StaticSoAVector requires a capacity greater than zero.");
+
+  using Indices = std::index_sequence_for<Fields...>;
+  using Columns = detail::SoAColumns<CAPACITY, Indices, Fields...>;
+
+  Columns m_columns;
+  detail::SizeType<CAPACITY> m_size = 0U;
+
+  static constexpr bool fields_are_trivially_destructible =
+      (std::is_trivially_destructible_v<Fields> && ...);
+
+ public:
+  template <size_t I>
+  using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+  using value_type      = std::tuple<Fields...>;
+  using size_type       = size_t;
+  using difference_type = ssize_t;
+  using reference       = detail::SoARow<Fields&...>;
+  using const_reference = detail::SoARow<const Fields&...>;
+  using iterator        = detail::SoAIterator<Columns, Fields...>;
+  using const_iterator  = detail::SoAIterator<const Columns, const Fields...>;
+
+  static constexpr size_t field_count = sizeof...(Fields);
+
+  constexpr StaticSoAVector() noexcept = default;
+  constexpr StaticSoAVector(std::initializer_list<value_type> rows) noexcept {
+    assert(rows.size() <= CAPACITY && "Size may not exceed capacity.");
+    for (const auto& row : rows) {
+      push_back(row);
+    }
+  }
+
+  // - Copy / move ---------------------------------------------------------------------------------
+  constexpr StaticSoAVector(const StaticSoAVector& other) noexcept {
+    for_each_column([&]<size_t I>() {
+      detail::copy_construct(column_data<I>(), other.template column_data<I>(), other.size());
+    });
+    m_size = other.m_size;
+  }
+  constexpr StaticSoAVector(StaticSoAVector&& other) noexcept {
+    for_each_column([&]<size_t I>() {
+      auto* first = other.template column_data<I>();
+      detail::uninitialized_move(first, first + other.size(), column_data<I>());
+    });
+    m_size = other.m_size;
+  }
+
+  constexpr auto operator=(const StaticSoAVector& other) noexcept -> StaticSoAVector& {
+    if (this != &other) {
+      clear();
+      for_each_column([&]<size_t I>() {
+        detail::copy_construct(column_data<I>(), other.template column_data<I>(), other.size());
+      });
+      m_size = other.m_size;
+    }
+    return *this;
+  }
+  constexpr auto operator=(StaticSoAVector&& other) noexcept -> StaticSoAVector& {
+    if (this != &other) {
+      clear();
+      for_each_column([&]<size_t I>() {
+        auto* first = other.template column_data<I>();
+        detail::uninitialized_move(first, first + other.size(), column_data<I>());
+      });
+      m_size = other.m_size;
+    }
+    return *this;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr ~StaticSoAVector() noexcept = default;
+  constexpr ~StaticSoAVector() noexcept
+  requires(!fields_are_trivially_destructible)
+  {
+    clear();
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto operator[](size_t idx) noexcept -> reference {
+    return make_row<reference>(*this, idx, Indices{});
+  }
+  [[nodiscard]] constexpr auto operator[](size_t idx) const noexcept -> const_reference {
+    return make_row<const_reference>(*this, idx, Indices{});
+  }
+
+  // Contiguous view of field `I` of all rows.
+  template <size_t I>
+  [[nodiscard]] constexpr auto column() noexcept -> std::span<field_type<I>> {
+    return std::span<field_type<I>>{column_data<I>(), size()};
+  }
+  template <size_t I>
+  [[nodiscard]] constexpr auto column() const noexcept -> std::span<const field_type<I>> {
+    return std::span<const field_type<I>>{column_data<I>(), size()};
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return m_size == 0UZ; }
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return m_size; }
+  [[nodiscard]] constexpr auto max_size() const noexcept -> size_type { return CAPACITY; }
+  constexpr void reserve([[maybe_unused]] size_type reserve_capacity) const noexcept {
+    assert(reserve_capacity <= CAPACITY && "Reserved capacity must be less than CAPACITY.");
+  }
+  [[nodiscard]] constexpr auto capacity() const noexcept -> size_type { return CAPACITY; }
+  constexpr void shrink_to_fit() const noexcept { /* NOOP */ }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator { return iterator{&m_columns, 0}; }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+    return const_iterator{&m_columns, 0};
+  }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return begin(); }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator {
+    return iterator{&m_columns, static_cast<difference_type>(m_size)};
+  }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator {
+    return const_iterator{&m_columns, static_cast<difference_type>(m_size)};
+  }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return end(); }
+
+  // ------------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto front() noexcept -> reference {
+    assert(m_size > 0UZ && "Vector must contain at least one element.");
+    return operator[](0UZ);
+  }
+  [[nodiscard]] constexpr auto front() const noexcept -> const_reference {
+    assert(m_size > 0UZ && "Vector must contain at least one element.");
+    return operator[](0UZ);
+  }
+  [[nodiscard]] constexpr auto back() noexcept -> reference {
+    assert(m_size > 0UZ && "Vector must contain at least one element.");
+    return operator[](m_size - 1UZ);
+  }
+  [[nodiscard]] constexpr auto back() const noexcept -> const_reference {
+    assert(m_size > 0UZ && "Vector must contain at least one element.");
+    return operator[](m_size - 1UZ);
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr void clear() noexcept {
+    if constexpr (!fields_are_trivially_destructible) {
+      for_each_column([&]<size_t I>() { std::destroy_n(column_data<I>(), size()); });
+    }
+    m_size = 0U;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr void push_back(const value_type& row) noexcept {
+    std::apply([&](const auto&... fields) { emplace_back(fields...); }, row);
+  }
+  constexpr void push_back(value_type&& row) noexcept {
+    std::apply([&](auto&... fields) { emplace_back(std::move(fields)...); }, row);
+  }
+
+  // Constructs field `I` of the new row from the `I`-th argument.
+  template <typename... Args>
+    requires(sizeof...(Args) == sizeof...(Fields))
+  constexpr void emplace_back(Args&&... args) noexcept {
+    assert(m_size < CAPACITY && "Size may not exceed capacity.");
+    [&]<size_t... Is>(std::index_sequence<Is...> /*indices*/) {
+      (std::construct_at(column_data<Is>() + m_size, std::forward<Args>(args)), ...);
+    }(Indices{});
+    ++m_size;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr auto pop_back() noexcept -> value_type {
+    assert(m_size > 0 && "Vector cannot be empty.");
+    --m_size;
+    return [&]<size_t... Is>(std::index_sequence<Is...> /*indices*/) {
+      value_type tmp{std::move(column_data<Is>()[m_size])...};
+      (std::destroy_at(column_data<Is>() + m_size), ...);
+      return tmp;
+    }(Indices{});
+  }
+
+ private:
+  template <size_t I>
+  [[nodiscard]] constexpr auto column_data() noexcept -> field_type<I>* {
+    return m_columns.template data<I>();
+  }
+  template <size_t I>
+  [[nodiscard]] constexpr auto column_data() const noexcept -> const field_type<I>* {
+    return m_columns.template data<I>();
+  }
+
+  template <typename Reference, typename Self, size_t... Is>
+  [[nodiscard]] static constexpr auto make_row(Self& self, size_t idx,
+                                               std::index_sequence<Is...> /*indices*/) noexcept
+      -> Reference {
+    return Reference{self.template column_data<Is>()[idx]...};
+  }
+
+  // Calls `f.template operator()<I>()` for every column index `I`.
+  template <typename F>
+  constexpr void for_each_column(F&& f) noexcept {
+    [&]<size_t... Is>(std::index_sequence<Is...> /*indices*/) {
+      (f.template operator()<Is>(), ...);
+    }(Indices{});
+  }
+};
+
+#endif  // STATIC_SOA_VECTOR_HPP_
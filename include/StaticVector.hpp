@@ -1,19 +1,223 @@
 #ifndef STATIC_VECTOR_HPP_
 #define STATIC_VECTOR_HPP_
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
 #include <type_traits>
+#include <utility>
 
+#include "Instrumentation.hpp"
 #include "ReverseIterator.hpp"
 #include "UninitializedArray.hpp"
 
+namespace detail {
+
+// -------------------------------------------------------------------------------------------------
+// Narrowest unsigned integer type that can represent every size in [0, CAPACITY].
+template <size_t CAPACITY>
+using SizeType = std::conditional_t<
+    CAPACITY <= UINT8_MAX,
+    std::uint8_t,
+    std::conditional_t<CAPACITY <= UINT16_MAX,
+                       std::uint16_t,
+                       std::conditional_t<CAPACITY <= UINT32_MAX, std::uint32_t, std::uint64_t>>>;
+
+// -------------------------------------------------------------------------------------------------
+// Elements that can be moved to another address by copying their bytes and forgetting about the
+// source object. Specialize for types that are trivially relocatable without being trivially
+// copyable, e.g. types owning a heap pointer without pointing into themselves.
+template <typename Element>
+struct is_trivially_relocatable : std::is_trivially_copyable<Element> {};
+
+template <typename Element>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<Element>::value;
+
+// -------------------------------------------------------------------------------------------------
+// Constant-evaluation friendly versions of the `<memory>` algorithms of the same name.
+template <typename Element>
+constexpr auto uninitialized_move(Element* first, Element* last, Element* dst) noexcept
+    -> Element* {
+  if consteval {
+    for (; first != last; ++first, ++dst) {
+      std::construct_at(dst, std::move(*first));
+    }
+    return dst;
+  } else {
+    return std::uninitialized_move(first, last, dst);
+  }
+}
+
+template <typename Element>
+constexpr auto uninitialized_fill_n(Element* dst, size_t count, const Element& value) noexcept
+    -> Element* {
+  if consteval {
+    for (size_t i = 0; i < count; ++i, ++dst) {
+      std::construct_at(dst, value);
+    }
+    return dst;
+  } else {
+    if constexpr (std::is_trivially_copyable_v<Element>) {
+      // A value whose bytes are all equal, e.g. zero, is filled with a single `memset`.
+      const auto* bytes = reinterpret_cast<const unsigned char*>(&value);  // NOLINT
+      const auto is_uniform =
+          std::all_of(bytes, bytes + sizeof(Element), [&](unsigned char b) { return b == *bytes; });
+      if (is_uniform) {
+        std::memset(static_cast<void*>(dst), *bytes, count * sizeof(Element));
+        return dst + count;
+      }
+
+      // Otherwise, fill the first block of fixed size in place and copy it with fixed-size
+      // `memcpy`s, which compile to plain vector stores.
+      constexpr size_t BLOCK_SIZE = std::max(64UZ / sizeof(Element), 1UZ);
+      if (count < BLOCK_SIZE) {
+        return std::uninitialized_fill_n(dst, count, value);
+      }
+      std::uninitialized_fill_n(dst, BLOCK_SIZE, value);
+      size_t i = BLOCK_SIZE;
+      for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE) {
+        std::memcpy(dst + i, dst, BLOCK_SIZE * sizeof(Element));
+      }
+      std::memcpy(dst + i, dst, (count - i) * sizeof(Element));
+      return dst + count;
+    } else {
+      return std::uninitialized_fill_n(dst, count, value);
+    }
+  }
+}
+
+template <typename Element>
+constexpr auto uninitialized_value_construct_n(Element* dst, size_t count) noexcept -> Element* {
+  if consteval {
+    for (size_t i = 0; i < count; ++i, ++dst) {
+      std::construct_at(dst);
+    }
+    return dst;
+  } else {
+    // Value-initialized scalars are all zero bytes.
+    if constexpr (std::is_arithmetic_v<Element> || std::is_enum_v<Element> ||
+                  std::is_pointer_v<Element>) {
+      std::memset(dst, 0, count * sizeof(Element));
+      return dst + count;
+    } else {
+      return std::uninitialized_value_construct_n(dst, count);
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Trivially relocatable elements are shifted with a single `memmove`, which is not available during
+// constant evaluation.
+template <typename Element>
+[[nodiscard]] constexpr auto relocate_with_memmove() noexcept -> bool {
+  if consteval {
+    return false;
+  } else {
+    return is_trivially_relocatable_v<Element>;
+  }
+}
+
 // -------------------------------------------------------------------------------------------------
-template <typename Element, size_t CAPACITY>
-class StaticVector {
+// Copy-constructs `count` elements starting at `src` into the uninitialized storage at `dst`.
+// Trivially copyable elements of the same type are copied from contiguous memory with a single
+// `memcpy`.
+template <typename Element, std::input_iterator InputIt>
+constexpr void copy_construct(Element* dst, InputIt src, size_t count) noexcept {
+  if consteval {
+    for (size_t i = 0; i < count; ++i, ++src) {
+      std::construct_at(dst + i, *src);
+    }
+  } else {
+    if constexpr (std::contiguous_iterator<InputIt> &&
+                  std::is_same_v<std::iter_value_t<InputIt>, Element> &&
+                  std::is_trivially_copyable_v<Element>) {
+      if (count > 0UZ) { std::memcpy(dst, std::to_address(src), count * sizeof(Element)); }
+    } else {
+      std::uninitialized_copy_n(src, count, dst);
+    }
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Swaps `bytes` bytes between `a` and `b` in blocks through a small buffer, which compiles to
+// vector loads and stores instead of a call per element.
+inline void swap_bytes(void* a, void* b, size_t bytes) noexcept {
+  constexpr size_t BLOCK = 64UZ;
+  auto* pa               = static_cast<unsigned char*>(a);
+  auto* pb               = static_cast<unsigned char*>(b);
+  unsigned char tmp[BLOCK];
+  for (; bytes >= BLOCK; bytes -= BLOCK, pa += BLOCK, pb += BLOCK) {
+    std::memcpy(tmp, pa, BLOCK);
+    std::memcpy(pa, pb, BLOCK);
+    std::memcpy(pb, tmp, BLOCK);
+  }
+  for (; bytes >= 8UZ; bytes -= 8UZ, pa += 8UZ, pb += 8UZ) {
+    std::memcpy(tmp, pa, 8UZ);
+    std::memcpy(pa, pb, 8UZ);
+    std::memcpy(pb, tmp, 8UZ);
+  }
+  for (; bytes > 0UZ; --bytes, ++pa, ++pb) {
+    std::swap(*pa, *pb);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Shifts [pos, end) back by `count` elements into the uninitialized storage behind `end`, such that
+// [pos, pos + count) is uninitialized storage afterwards.
+template <typename Element>
+constexpr void shift_back(Element* pos, Element* end, size_t count) noexcept {
+  if (relocate_with_memmove<Element>()) {
+    std::memmove(static_cast<void*>(pos + count),
+                 static_cast<const void*>(pos),
+                 static_cast<size_t>(end - pos) * sizeof(Element));
+  } else {
+    // Elements that are shifted past the old end are move-constructed, the others are
+    // move-assigned. The moved-from elements left in the gap are destroyed.
+    const auto alive = std::min(count, static_cast<size_t>(end - pos));
+    uninitialized_move(end - alive, end, end + (count - alive));
+    std::move_backward(pos, end - alive, end);
+    std::destroy(pos, pos + alive);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+// Tag for constructing a vector from a range, `std::from_range_t` where the standard library
+// provides it.
+#ifdef __cpp_lib_containers_ranges
+using from_range_t = std::from_range_t;
+inline constexpr from_range_t from_range = std::from_range;
+#else
+struct from_range_t {
+  explicit from_range_t() = default;
+};
+inline constexpr from_range_t from_range{};
+#endif  // __cpp_lib_containers_ranges
+
+template <typename Range, typename Element>
+concept ContainerCompatibleRange =
+    std::ranges::input_range<Range> &&
+    std::constructible_from<Element, std::ranges::range_reference_t<Range>>;
+
+}  // namespace detail
+
+// -------------------------------------------------------------------------------------------------
+// The alignment policy applies to the vector instead of the storage member: the storage starts at
+// offset zero either way, but the size can only use the padding at the end of the vector. The
+// alignment never drops below that of the size, an alignas weaker than the natural alignment of the
+// class would be ill-formed.
+template <typename Element, size_t CAPACITY, typename Alignment = ElementAligned>
+class alignas(std::max(Alignment::template alignment<Element>,
+                       alignof(detail::SizeType<CAPACITY>))) StaticVector {
+  // The size is stored behind the storage in the narrowest type that can hold `CAPACITY`, such that
+  // it fills the tail padding of the storage instead of adding padding itself.
   detail::UninitializedArray<Element, CAPACITY> m_storage;
-  size_t m_size = 0UZ;
+  detail::SizeType<CAPACITY> m_size = 0U;
 
  public:
   using value_type             = Element;
@@ -33,67 +237,63 @@ class StaticVector {
 
   constexpr StaticVector() noexcept = default;
   constexpr StaticVector(size_t size, const Element& init = Element{}) noexcept {
-    for (size_t i = 0; i < size; ++i) {
-      push_back(init);
-    }
+    detail::instrument::on_resize<Element, CAPACITY>(size);
+    assert(size <= CAPACITY && "Size may not exceed capacity.");
+    detail::uninitialized_fill_n(m_storage.data(), size, init);
+    m_size = static_cast<detail::SizeType<CAPACITY>>(size);
   }
   constexpr StaticVector(std::initializer_list<Element> values) noexcept {
-    for (auto& v : values) {
-      push_back(std::move(v));
-    }
+    append_copy(values.begin(), values.size());
+  }
+  template <detail::ContainerCompatibleRange<Element> Range>
+  constexpr StaticVector(detail::from_range_t /*tag*/, Range&& range) noexcept {
+    append_range(std::forward<Range>(range));
   }
 
   // - Copy constructor ----------------------------------------------------------------------------
   constexpr StaticVector(const StaticVector& other) noexcept {
-    for (const auto& e : other) {
-      push_back(e);
-    }
+    append_copy(other.data(), other.size());
   }
 
-  template <typename OtherElement, size_t OTHER_CAPACITY>
-  constexpr StaticVector(const StaticVector<OtherElement, OTHER_CAPACITY>& other) noexcept {
+  template <typename OtherElement, size_t OTHER_CAPACITY, typename OtherAlignment>
+  constexpr StaticVector(
+      const StaticVector<OtherElement, OTHER_CAPACITY, OtherAlignment>& other) noexcept {
     if constexpr (OTHER_CAPACITY > CAPACITY) {
       assert(other.size() <= CAPACITY &&
              "Size of vector must be less than or equal to the capacity.");
     }
 
-    for (const auto& e : other) {
-      push_back(Element{e});
-    }
+    append_copy(other.data(), other.size());
   }
 
   // - Move constructor ----------------------------------------------------------------------------
   constexpr StaticVector(StaticVector&& other) noexcept {
-    for (auto& e : other) {
-      push_back(std::move(e));
-    }
+    append_move(other.data(), other.size());
   }
 
-  template <typename OtherElement, size_t OTHER_CAPACITY>
-  constexpr StaticVector(StaticVector<OtherElement, OTHER_CAPACITY>&& other) noexcept {
+  template <typename OtherElement, size_t OTHER_CAPACITY, typename OtherAlignment>
+  constexpr StaticVector(
+      StaticVector<OtherElement, OTHER_CAPACITY, OtherAlignment>&& other) noexcept {
     if constexpr (OTHER_CAPACITY > CAPACITY) {
       assert(other.size() <= CAPACITY &&
              "Size of vector must be less than or equal to the capacity.");
     }
 
-    for (auto& e : other) {
-      push_back(Element{std::move(e)});
-    }
+    append_move(other.data(), other.size());
   }
 
   // - Copy assignment -----------------------------------------------------------------------------
   constexpr auto operator=(const StaticVector& other) noexcept -> StaticVector& {
     if (this != &other) {
       clear();
-      for (const auto& e : other) {
-        push_back(e);
-      }
+      append_copy(other.data(), other.size());
     }
     return *this;
   }
 
-  template <typename OtherElement, size_t OTHER_CAPACITY>
-  constexpr auto operator=(const StaticVector<OtherElement, OTHER_CAPACITY>& other) noexcept
+  template <typename OtherElement, size_t OTHER_CAPACITY, typename OtherAlignment>
+  constexpr auto
+  operator=(const StaticVector<OtherElement, OTHER_CAPACITY, OtherAlignment>& other) noexcept
       -> StaticVector& {
     if constexpr (OTHER_CAPACITY > CAPACITY) {
       assert(other.size() <= CAPACITY &&
@@ -101,9 +301,7 @@ class StaticVector {
     }
 
     clear();
-    for (const auto& e : other) {
-      push_back(Element{e});
-    }
+    append_copy(other.data(), other.size());
     return *this;
   }
 
@@ -111,15 +309,14 @@ class StaticVector {
   constexpr auto operator=(StaticVector&& other) noexcept -> StaticVector& {
     if (this != &other) {
       clear();
-      for (auto& e : other) {
-        push_back(std::move(e));
-      }
+      append_move(other.data(), other.size());
     }
     return *this;
   }
 
-  template <typename OtherElement, size_t OTHER_CAPACITY>
-  constexpr auto operator=(StaticVector<OtherElement, OTHER_CAPACITY>&& other) noexcept
+  template <typename OtherElement, size_t OTHER_CAPACITY, typename OtherAlignment>
+  constexpr auto
+  operator=(StaticVector<OtherElement, OTHER_CAPACITY, OtherAlignment>&& other) noexcept
       -> StaticVector& {
     if constexpr (OTHER_CAPACITY > CAPACITY) {
       assert(other.size() <= CAPACITY &&
@@ -127,9 +324,7 @@ class StaticVector {
     }
 
     clear();
-    for (auto& e : other) {
-      push_back(std::move(e));
-    }
+    append_move(other.data(), other.size());
     return *this;
   }
 
@@ -181,22 +376,22 @@ class StaticVector {
 
   // -----------------------------------------------------------------------------------------------
   [[nodiscard]] constexpr auto rbegin() noexcept -> reverse_iterator {
-    return reverse_iterator{m_storage.data() + static_cast<difference_type>(m_size) - 1};
+    return reverse_iterator{m_storage.data() + m_size};
   }
   [[nodiscard]] constexpr auto rbegin() const noexcept -> const_reverse_iterator {
-    return const_reverse_iterator{m_storage.data() + static_cast<difference_type>(m_size) - 1};
+    return const_reverse_iterator{m_storage.data() + m_size};
   }
   [[nodiscard]] constexpr auto crbegin() const noexcept -> const_reverse_iterator {
-    return const_reverse_iterator{m_storage.data() + static_cast<difference_type>(m_size) - 1};
+    return const_reverse_iterator{m_storage.data() + m_size};
   }
   [[nodiscard]] constexpr auto rend() noexcept -> reverse_iterator {
-    return reverse_iterator{m_storage.data() - 1};
+    return reverse_iterator{m_storage.data()};
   }
   [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator {
-    return const_reverse_iterator{m_storage.data() - 1};
+    return const_reverse_iterator{m_storage.data()};
   }
   [[nodiscard]] constexpr auto crend() const noexcept -> const_reverse_iterator {
-    return const_reverse_iterator{m_storage.data() - 1};
+    return const_reverse_iterator{m_storage.data()};
   }
 
   // ------------------------------------------------------------------------------------------------
@@ -224,47 +419,389 @@ class StaticVector {
         std::destroy_at(m_storage.data() + i);
       }
     }
-    m_size = 0UZ;
+    m_size = 0U;
   }
 
   // -------------------------------------------------------------------------------------------------
   constexpr void push_back(const Element& e) noexcept {
     assert(m_size < CAPACITY && "Size may not exceed capacity.");
-    std::construct_at(m_storage.data() + m_size, e);
-    m_size += 1;
+    unchecked_emplace_back(e);
   }
   constexpr void push_back(Element&& e) noexcept {
     assert(m_size < CAPACITY && "Size may not exceed capacity.");
-    std::construct_at(m_storage.data() + m_size, std::move(e));
-    m_size += 1;
+    unchecked_emplace_back(std::move(e));
   }
 
   // -------------------------------------------------------------------------------------------------
   template <typename... Args>
   constexpr void emplace_back(Args&&... args) noexcept {
     assert(m_size < CAPACITY && "Size may not exceed capacity.");
-    std::construct_at(m_storage.data() + m_size, std::forward<Args>(args)...);
-    m_size += 1;
+    unchecked_emplace_back(std::forward<Args>(args)...);
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Appends the element if the vector is not full. Returns a pointer to the new element, or null if
+  // the vector is full; the arguments are left untouched then.
+  constexpr auto try_push_back(const Element& e) noexcept -> pointer { return try_emplace_back(e); }
+  constexpr auto try_push_back(Element&& e) noexcept -> pointer {
+    return try_emplace_back(std::move(e));
+  }
+
+  template <typename... Args>
+  constexpr auto try_emplace_back(Args&&... args) noexcept -> pointer {
+    if (m_size == CAPACITY) [[unlikely]] {
+      detail::instrument::on_overflow<Element, CAPACITY>();
+      return nullptr;
+    }
+    return &unchecked_emplace_back(std::forward<Args>(args)...);
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Appends the element without checking the capacity, not even in debug builds. The vector must
+  // not be full, e.g. because the caller checked the size of a whole batch up front.
+  constexpr auto unchecked_push_back(const Element& e) noexcept -> reference {
+    return unchecked_emplace_back(e);
+  }
+  constexpr auto unchecked_push_back(Element&& e) noexcept -> reference {
+    return unchecked_emplace_back(std::move(e));
+  }
+
+  template <typename... Args>
+  constexpr auto unchecked_emplace_back(Args&&... args) noexcept -> reference {
+    detail::instrument::on_push<Element, CAPACITY>(m_size);
+    Element* e = std::construct_at(m_storage.data() + m_size, std::forward<Args>(args)...);
+    ++m_size;
+    return *e;
   }
 
   // -------------------------------------------------------------------------------------------------
   constexpr auto pop_back() noexcept -> value_type {
     assert(m_size > 0 && "Vector cannot be empty.");
-    m_size -= 1;
+    detail::instrument::on_pop<Element, CAPACITY>(m_size);
+    --m_size;
     auto tmp = std::move(operator[](m_size));
     std::destroy_at(m_storage.data() + m_size);
     return tmp;
   }
 
   // -------------------------------------------------------------------------------------------------
-  // TODO:
-  // - insert
-  // - insert_range
-  // - emplace
-  // - erase
-  // - append_range
-  // - resize
-  // - swap
+  template <typename... Args>
+  constexpr auto emplace(const_iterator pos, Args&&... args) noexcept -> iterator {
+    assert(m_size < CAPACITY && "Size may not exceed capacity.");
+    const auto it = to_mutable_iterator(pos);
+    if (it == end()) {
+      emplace_back(std::forward<Args>(args)...);
+      return it;
+    }
+
+    // Construct the new element before shifting, `args` might refer to an element of the vector.
+    Element tmp(std::forward<Args>(args)...);
+    open_gap(it, 1UZ);
+    std::construct_at(it, std::move(tmp));
+    return it;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr auto insert(const_iterator pos, const Element& value) noexcept -> iterator {
+    return emplace(pos, value);
+  }
+  constexpr auto insert(const_iterator pos, Element&& value) noexcept -> iterator {
+    return emplace(pos, std::move(value));
+  }
+  constexpr auto insert(const_iterator pos, size_type count, const Element& value) noexcept
+      -> iterator {
+    assert(m_size + count <= CAPACITY && "Size may not exceed capacity.");
+    const auto it = to_mutable_iterator(pos);
+    if (count == 0UZ) { return it; }
+
+    const Element tmp(value);
+    open_gap(it, count);
+    detail::uninitialized_fill_n(it, count, tmp);
+    return it;
+  }
+  template <std::input_iterator InputIt>
+  constexpr auto insert(const_iterator pos, InputIt first, InputIt last) noexcept -> iterator {
+    return insert_range(pos, std::ranges::subrange(std::move(first), std::move(last)));
+  }
+  constexpr auto insert(const_iterator pos, std::initializer_list<Element> values) noexcept
+      -> iterator {
+    return insert(pos, values.begin(), values.end());
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Inserts all elements of `range` before `pos`. If the size of `range` is known up front, the
+  // capacity is checked once and the elements are copied in bulk.
+  template <detail::ContainerCompatibleRange<Element> Range>
+  constexpr auto insert_range(const_iterator pos, Range&& range) noexcept -> iterator {
+    const auto it = to_mutable_iterator(pos);
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>) {
+      const auto count = static_cast<size_type>(std::ranges::distance(range));
+      assert(m_size + count <= CAPACITY && "Size may not exceed capacity.");
+      open_gap(it, count);
+      detail::copy_construct(it, std::ranges::begin(range), count);
+    } else {
+      // The number of elements is unknown up front: append them and rotate them into place.
+      const auto old_end = end();
+      append_range(std::forward<Range>(range));
+      std::rotate(it, old_end, end());
+    }
+    return it;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Appends all elements of `range`. If the size of `range` is known up front, the capacity is
+  // checked once and the elements are copied in bulk.
+  template <detail::ContainerCompatibleRange<Element> Range>
+  constexpr void append_range(Range&& range) noexcept {
+    if constexpr (std::ranges::forward_range<Range> || std::ranges::sized_range<Range>) {
+      append_copy(std::ranges::begin(range), static_cast<size_type>(std::ranges::distance(range)));
+    } else {
+      for (auto&& e : range) {
+        emplace_back(std::forward<decltype(e)>(e));
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr void append(const Element* values, size_type count) noexcept {
+    append_copy(values, count);
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  constexpr auto erase(const_iterator pos) noexcept -> iterator {
+    assert(pos != end() && "Cannot erase end iterator.");
+    return erase(pos, pos + 1);
+  }
+  constexpr auto erase(const_iterator first, const_iterator last) noexcept -> iterator {
+    assert(cbegin() <= first && first <= last && last <= cend() && "Invalid iterator range.");
+    const auto it_first = to_mutable_iterator(first);
+    const auto it_last  = to_mutable_iterator(last);
+    const auto count    = static_cast<size_type>(it_last - it_first);
+    if (count == 0UZ) { return it_first; }
+
+    if (detail::relocate_with_memmove<Element>()) {
+      std::destroy(it_first, it_last);
+      std::memmove(static_cast<void*>(it_first),
+                   static_cast<const void*>(it_last),
+                   static_cast<size_type>(end() - it_last) * sizeof(Element));
+    } else {
+      const auto new_end = std::move(it_last, end(), it_first);
+      std::destroy(new_end, end());
+    }
+    m_size = static_cast<detail::SizeType<CAPACITY>>(m_size - count);
+    return it_first;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Erases the element at `pos` in constant time by moving the last element into its place, which
+  // does not keep the order of the elements. Returns an iterator to the moved element.
+  constexpr auto unordered_erase(const_iterator pos) noexcept -> iterator {
+    assert(pos != end() && "Cannot erase end iterator.");
+    const auto it = to_mutable_iterator(pos);
+    Element* last = end() - 1;
+    if (it != last) { *it = std::move(*last); }
+    detail::instrument::on_pop<Element, CAPACITY>(m_size);
+    std::destroy_at(last);
+    --m_size;
+    return it;
+  }
+
+  // Removes the element at `idx` like `unordered_erase` and returns it.
+  constexpr auto swap_remove(size_type idx) noexcept -> value_type {
+    assert(idx < m_size && "Index out of bounds.");
+    auto res = std::move(operator[](idx));
+    unordered_erase(begin() + idx);
+    return res;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Appended elements are value-initialized, i.e. zeroed for scalar types.
+  constexpr void resize(size_type new_size) noexcept {
+    detail::instrument::on_resize<Element, CAPACITY>(new_size);
+    assert(new_size <= CAPACITY && "Size may not exceed capacity.");
+    if (new_size <= m_size) {
+      std::destroy(begin() + new_size, end());
+    } else {
+      detail::uninitialized_value_construct_n(end(), new_size - m_size);
+    }
+    m_size = static_cast<detail::SizeType<CAPACITY>>(new_size);
+  }
+  constexpr void resize(size_type new_size, const Element& value) noexcept {
+    detail::instrument::on_resize<Element, CAPACITY>(new_size);
+    assert(new_size <= CAPACITY && "Size may not exceed capacity.");
+    if (new_size <= m_size) {
+      std::destroy(begin() + new_size, end());
+    } else {
+      detail::uninitialized_fill_n(end(), new_size - m_size, value);
+    }
+    m_size = static_cast<detail::SizeType<CAPACITY>>(new_size);
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Appended elements are default-initialized, i.e. they are left uninitialized if
+  // `constructor_and_destructor_are_cheap`. This allows to write directly into `data()`, e.g. with
+  // `read`, without paying for initializing the memory first.
+  constexpr void resize_for_overwrite(size_type new_size) noexcept
+  requires(std::is_default_constructible_v<Element>)
+  {
+    detail::instrument::on_resize<Element, CAPACITY>(new_size);
+    assert(new_size <= CAPACITY && "Size may not exceed capacity.");
+    if (new_size <= m_size) {
+      std::destroy(begin() + new_size, end());
+    } else if constexpr (!constructor_and_destructor_are_cheap) {
+      std::uninitialized_default_construct(end(), begin() + new_size);
+    }
+    m_size = static_cast<detail::SizeType<CAPACITY>>(new_size);
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Swaps the elements without a temporary vector: the common prefix is swapped in place and the
+  // tail of the longer vector is relocated behind the elements of the shorter one. Trivially
+  // relocatable elements are swapped and relocated as bytes.
+  constexpr void swap(StaticVector& other) noexcept {
+    if (this == &other) { return; }
+    StaticVector& shorter  = m_size <= other.m_size ? *this : other;
+    StaticVector& longer   = m_size <= other.m_size ? other : *this;
+    const size_type common = shorter.m_size;
+    const size_type tail   = longer.m_size - common;
+    Element* dst           = shorter.data() + common;
+    Element* src           = longer.data() + common;
+
+    if (detail::relocate_with_memmove<Element>()) {
+      detail::swap_bytes(shorter.data(), longer.data(), common * sizeof(Element));
+      std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), tail * sizeof(Element));
+    } else {
+      std::swap_ranges(shorter.data(), dst, longer.data());
+      detail::uninitialized_move(src, src + tail, dst);
+      std::destroy(src, src + tail);
+    }
+    std::swap(m_size, other.m_size);
+  }
+
+  friend constexpr void swap(StaticVector& lhs, StaticVector& rhs) noexcept { lhs.swap(rhs); }
+
+ private:
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto to_mutable_iterator(const_iterator pos) noexcept -> iterator {
+    assert(cbegin() <= pos && pos <= cend() && "Iterator must be in [begin, end].");
+    return begin() + (pos - cbegin());
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Shifts [pos, end) back by `count` elements, such that [pos, pos + count) is uninitialized
+  // storage afterwards, and accounts for the new elements in the size.
+  constexpr void open_gap(iterator pos, size_type count) noexcept {
+    detail::instrument::on_resize<Element, CAPACITY>(m_size + count);
+    detail::shift_back(pos, end(), count);
+    m_size = static_cast<detail::SizeType<CAPACITY>>(m_size + count);
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  template <std::input_iterator InputIt>
+  constexpr void append_copy(InputIt src, size_type count) noexcept {
+    detail::instrument::on_resize<Element, CAPACITY>(m_size + count);
+    assert(m_size + count <= CAPACITY && "Size may not exceed capacity.");
+    detail::copy_construct(m_storage.data() + m_size, src, count);
+    m_size = static_cast<detail::SizeType<CAPACITY>>(m_size + count);
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Move-constructs `count` elements from `src` behind the last element. The moved-from elements
+  // stay alive in `src`.
+  template <typename OtherElement>
+  constexpr void append_move(OtherElement* src, size_type count) noexcept {
+    detail::instrument::on_resize<Element, CAPACITY>(m_size + count);
+    assert(m_size + count <= CAPACITY && "Size may not exceed capacity.");
+    Element* dst = m_storage.data() + m_size;
+    if consteval {
+      for (size_type i = 0; i < count; ++i) {
+        std::construct_at(dst + i, std::move(src[i]));
+      }
+    } else {
+      if constexpr (std::is_same_v<Element, OtherElement> &&
+                    std::is_trivially_copyable_v<Element>) {
+        if (count > 0UZ) { std::memcpy(dst, src, count * sizeof(Element)); }
+      } else {
+        std::uninitialized_move_n(src, count, dst);
+      }
+    }
+    m_size = static_cast<detail::SizeType<CAPACITY>>(m_size + count);
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+// A vector without capacity never holds an element, so it stores nothing at all. Only the
+// non-mutating part of the interface is provided; inserting into it is a compile-time error. The
+// alignment policy still applies without the element alignment: with the default it takes a single
+// byte, a cache line isolated one occupies a whole cache line.
+template <typename Element, typename Alignment>
+class alignas(Alignment::minimum_alignment) StaticVector<Element, 0UZ, Alignment> {
+ public:
+  using value_type             = Element;
+  using size_type              = size_t;
+  using difference_type        = ssize_t;
+  using reference              = value_type&;
+  using const_reference        = const value_type&;
+  using pointer                = value_type*;
+  using const_pointer          = const value_type*;
+  using iterator               = pointer;
+  using const_iterator         = const_pointer;
+  using reverse_iterator       = detail::ReverseIterator<Element>;
+  using const_reverse_iterator = detail::ConstReverseIterator<Element>;
+
+  static constexpr auto constructor_and_destructor_are_cheap = true;
+
+  constexpr StaticVector() noexcept = default;
+
+  template <typename OtherElement, size_t OTHER_CAPACITY, typename OtherAlignment>
+  constexpr StaticVector([[maybe_unused]] const StaticVector<OtherElement, OTHER_CAPACITY,
+                                                             OtherAlignment>& other) noexcept {
+    assert(other.empty() && "Size of vector must be less than or equal to the capacity.");
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto data() noexcept -> pointer { return nullptr; }
+  [[nodiscard]] constexpr auto data() const noexcept -> const_pointer { return nullptr; }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool { return true; }
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type { return 0UZ; }
+  [[nodiscard]] constexpr auto max_size() const noexcept -> size_type { return 0UZ; }
+  constexpr void reserve([[maybe_unused]] size_type reserve_capacity) const noexcept {
+    assert(reserve_capacity == 0UZ && "Reserved capacity must be less than CAPACITY.");
+  }
+  [[nodiscard]] constexpr auto capacity() const noexcept -> size_type { return 0UZ; }
+  constexpr void shrink_to_fit() const noexcept { /* NOOP */ }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto begin() noexcept -> iterator { return nullptr; }
+  [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator { return nullptr; }
+  [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator { return nullptr; }
+  [[nodiscard]] constexpr auto end() noexcept -> iterator { return nullptr; }
+  [[nodiscard]] constexpr auto end() const noexcept -> const_iterator { return nullptr; }
+  [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator { return nullptr; }
+
+  // -----------------------------------------------------------------------------------------------
+  [[nodiscard]] constexpr auto rbegin() noexcept -> reverse_iterator { return {}; }
+  [[nodiscard]] constexpr auto rbegin() const noexcept -> const_reverse_iterator { return {}; }
+  [[nodiscard]] constexpr auto crbegin() const noexcept -> const_reverse_iterator { return {}; }
+  [[nodiscard]] constexpr auto rend() noexcept -> reverse_iterator { return {}; }
+  [[nodiscard]] constexpr auto rend() const noexcept -> const_reverse_iterator { return {}; }
+  [[nodiscard]] constexpr auto crend() const noexcept -> const_reverse_iterator { return {}; }
+
+  // -----------------------------------------------------------------------------------------------
+  constexpr void clear() noexcept { /* NOOP */ }
+  constexpr void swap(StaticVector& /*other*/) noexcept { /* NOOP */ }
+  friend constexpr void swap(StaticVector& /*lhs*/, StaticVector& /*rhs*/) noexcept { /* NOOP */ }
+
+  // -----------------------------------------------------------------------------------------------
+  // The vector is always full.
+  constexpr auto try_push_back(const Element& /*e*/) noexcept -> pointer { return nullptr; }
+  constexpr auto try_push_back(Element&& /*e*/) noexcept -> pointer { return nullptr; }
+  template <typename... Args>
+  constexpr auto try_emplace_back(Args&&... /*args*/) noexcept -> pointer {
+    return nullptr;
+  }
 };
 
 #endif  // STATIC_VECTOR_HPP_
@@ -2,42 +2,65 @@
 #define UNINITIALIZED_ARRAY_HPP_
 
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 
-namespace detail {
+#include "Alignment.hpp"
 
-// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+namespace detail {
 
 // -------------------------------------------------------------------------------------------------
-template <typename Element, size_t CAPACITY>
+// Storage for `CAPACITY` elements, of which only those constructed with `std::construct_at` are
+// alive. Elements that are cheap to construct and destroy are stored in a plain array, whose
+// default initialization does nothing. Other elements are stored in an array that is the only
+// member of a union: the union neither constructs nor destroys it, but unlike an array of bytes it
+// can be accessed as `Element*` during constant evaluation.
+template <typename Element, size_t CAPACITY, typename Alignment = ElementAligned>
 struct UninitializedArray {
   static constexpr bool constructor_and_destructor_are_cheap =
       std::is_trivially_default_constructible_v<Element> &&
       std::is_trivially_destructible_v<Element>;
 
+  union Elements {
+    constexpr Elements() noexcept {}   // NOLINT(modernize-use-equals-default)
+    constexpr ~Elements() noexcept {}  // NOLINT(modernize-use-equals-default)
+    Element m_elements[CAPACITY];      // NOLINT
+  };
+
   using Storage_t = std::conditional_t<constructor_and_destructor_are_cheap,
-                                       Element[CAPACITY],                       // NOLINT
-                                       std::byte[CAPACITY * sizeof(Element)]>;  // NOLINT
-  alignas(Element) Storage_t m_data;
+                                       Element[CAPACITY],  // NOLINT
+                                       Elements>;
+  alignas(Alignment::template alignment<Element>) Storage_t m_data;
+
+  // The result of a constant expression must not contain uninitialized scalars, so the spare cheap
+  // elements are value-initialized during constant evaluation. This allows constexpr vectors that
+  // are not full, e.g. lookup tables in read-only data. At run time the storage stays untouched.
+  constexpr UninitializedArray() noexcept {  // NOLINT(cppcoreguidelines-pro-type-member-init)
+    if constexpr (constructor_and_destructor_are_cheap) {
+      if consteval {
+        for (auto& e : m_data) {
+          std::construct_at(&e);
+        }
+      }
+    }
+  }
 
   [[nodiscard]] constexpr auto data() noexcept -> Element* {
     if constexpr (constructor_and_destructor_are_cheap) {
       return m_data;
     } else {
-      return reinterpret_cast<Element*>(m_data);
+      return m_data.m_elements;
     }
   }
   [[nodiscard]] constexpr auto data() const noexcept -> const Element* {
     if constexpr (constructor_and_destructor_are_cheap) {
       return m_data;
     } else {
-      return reinterpret_cast<const Element*>(m_data);
+      return m_data.m_elements;
     }
   }
 };
 
-// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
-
 }  // namespace detail
 
 #endif  // UNINITIALIZED_ARRAY_HPP_
@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+"""Checks properties of the assembly generated for the probe functions in `codegen_probes.cpp`.
+
+Every probe is preceded by `// CHECK: <check>` lines. Available checks:
+
+  no-call                 the probe contains no `call` and no tail call
+  no-loop                 the control flow of the probe and its local callees has no cycle
+  max-instructions <n>    the probe itself has at most <n> instructions
+  calls <symbol> <n>      the probe and its local callees call <symbol> exactly <n> times
+  only-calls <symbol>...  the probe and its local callees call no other external functions
+  vector-loop             the probe or one of its local callees has a loop using vector registers
+
+Local callees are functions defined in the same assembly file, e.g. helpers the compiler decided
+not to inline. Only x86-64 assembly in AT&T syntax, as emitted by GCC and Clang, is supported.
+"""
+
+import argparse
+import dataclasses
+import pathlib
+import re
+import sys
+
+CHECK_RE = re.compile(r"^\s*//\s*CHECK:\s*(.+?)\s*$")
+PROBE_RE = re.compile(r"\b(probe_\w+)\s*\(")
+LABEL_RE = re.compile(r"^([A-Za-z_.$][\w.$@]*):")
+JUMP_RE = re.compile(r"^(j\w+)\s+(\S+)$")
+CALL_RE = re.compile(r"^call\w*\s+(\S+)$")
+VECTOR_REGISTER_RE = re.compile(r"%[xyz]mm\d+")
+
+
+@dataclasses.dataclass
+class Function:
+    instructions: list[str] = dataclasses.field(default_factory=list)
+    labels: dict[str, int] = dataclasses.field(default_factory=dict)
+
+    def calls(self) -> list[str]:
+        """Call targets, including tail calls, without `@PLT` suffix."""
+        targets = []
+        for instruction in self.instructions:
+            if (match := CALL_RE.match(instruction)) is None:
+                match = JUMP_RE.match(instruction)
+                if match is None or match.group(2).startswith((".L", "*")):
+                    continue
+                target = match.group(2)
+            else:
+                target = match.group(1)
+            targets.append(target.split("@")[0])
+        return targets
+
+    def successors(self, idx: int) -> list[int]:
+        instruction = self.instructions[idx]
+        if instruction.startswith("ret") or instruction.startswith("ud2"):
+            return []
+        fallthrough = [idx + 1] if idx + 1 < len(self.instructions) else []
+        match = JUMP_RE.match(instruction)
+        if match is None:
+            return fallthrough
+        target = self.labels.get(match.group(2))
+        targets = [target] if target is not None and target < len(self.instructions) else []
+        return targets if match.group(1) == "jmp" else targets + fallthrough
+
+    def loops(self) -> list[set[int]]:
+        """Instruction indices of every loop, i.e. of every cycle in the control flow graph."""
+        back_edges = []
+        state = [0] * len(self.instructions)  # 0: unvisited, 1: on the DFS stack, 2: finished
+        stack = [(0, iter(self.successors(0)))] if self.instructions else []
+        if stack:
+            state[0] = 1
+        while stack:
+            node, successors = stack[-1]
+            succ = next(successors, None)
+            if succ is None:
+                state[node] = 2
+                stack.pop()
+            elif state[succ] == 1:
+                back_edges.append((node, succ))
+            elif state[succ] == 0:
+                state[succ] = 1
+                stack.append((succ, iter(self.successors(succ))))
+
+        predecessors: dict[int, list[int]] = {}
+        for idx in range(len(self.instructions)):
+            for succ in self.successors(idx):
+                predecessors.setdefault(succ, []).append(idx)
+
+        res = []
+        for tail, head in back_edges:
+            body, todo = {head}, [tail]
+            while todo:
+                node = todo.pop()
+                if node not in body:
+                    body.add(node)
+                    todo.extend(predecessors.get(node, []))
+            res.append(body)
+        return res
+
+
+def parse_assembly(path: pathlib.Path) -> dict[str, Function]:
+    functions: dict[str, Function] = {}
+    current = None
+    for line in path.read_text().splitlines():
+        line = line.split("#")[0].strip()
+        if not line:
+            continue
+        if (match := LABEL_RE.match(line)) is not None:
+            name = match.group(1)
+            if name.startswith(".L"):
+                if current is not None:
+                    current.labels[name] = len(current.instructions)
+            else:
+                current = functions.setdefault(name, Function())
+        elif not line.startswith(".") and current is not None:
+            current.instructions.append(" ".join(line.split()))
+    return functions
+
+
+def parse_checks(path: pathlib.Path) -> dict[str, list[str]]:
+    checks: dict[str, list[str]] = {}
+    pending: list[str] = []
+    for line in path.read_text().splitlines():
+        if (match := CHECK_RE.match(line)) is not None:
+            pending.append(match.group(1))
+        elif pending and (match := PROBE_RE.search(line)) is not None:
+            checks[match.group(1)] = pending
+            pending = []
+    if pending:
+        raise SystemExit(f"CHECK lines at the end of '{path}' are not followed by a probe.")
+    return checks
+
+
+def with_callees(name: str, functions: dict[str, Function]) -> list[Function]:
+    """The function and all functions it calls transitively that are defined in the file."""
+    res: list[Function] = []
+    todo, seen = [name], set()
+    while todo:
+        current = todo.pop()
+        if current in seen or current not in functions:
+            continue
+        seen.add(current)
+        res.append(functions[current])
+        todo.extend(functions[current].calls())
+    return res
+
+
+def run_check(check: str, name: str, functions: dict[str, Function]) -> str | None:
+    """Returns an error message if the check fails."""
+    probe = functions[name]
+    reachable = with_callees(name, functions)
+    kind, *args = check.split()
+    if kind == "no-call":
+        if calls := probe.calls():
+            return f"calls {', '.join(calls)}"
+    elif kind == "no-loop":
+        if any(f.loops() for f in reachable):
+            return "contains a loop"
+    elif kind == "max-instructions":
+        if len(probe.instructions) > int(args[0]):
+            return f"has {len(probe.instructions)} instructions"
+    elif kind == "calls":
+        count = sum(f.calls().count(args[0]) for f in reachable)
+        if count != int(args[1]):
+            return f"calls {args[0]} {count} times"
+    elif kind == "only-calls":
+        external = [c for f in reachable for c in f.calls() if c not in functions]
+        if others := [c for c in external if c not in args]:
+            return f"calls {', '.join(others)}"
+    elif kind == "vector-loop":
+        for f in reachable:
+            for body in f.loops():
+                if any(VECTOR_REGISTER_RE.search(f.instructions[i]) for i in body):
+                    return None
+        return "has no loop using vector registers"
+    else:
+        return "unknown check"
+    return None
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("source", type=pathlib.Path, help="probe source with CHECK lines")
+    parser.add_argument("assembly", type=pathlib.Path, help="assembly generated from the source")
+    args = parser.parse_args()
+
+    checks = parse_checks(args.source)
+    functions = parse_assembly(args.assembly)
+
+    failures = 0
+    for name, probe_checks in checks.items():
+        for check in probe_checks:
+            error = f"not found in '{args.assembly}'" if name not in functions else None
+            error = error or run_check(check, name, functions)
+            status = "FAIL" if error else "ok"
+            print(f"{status:<4}  {name}: {check}" + (f"  <-- {error}" if error else ""))
+            failures += error is not None
+
+    if failures:
+        print(f"\n{failures} codegen check(s) failed.")
+        return 1
+    print(f"\nAll {sum(len(c) for c in checks.values())} codegen checks passed.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
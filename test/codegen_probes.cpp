@@ -0,0 +1,45 @@
+// Probe functions for the codegen regression test. This file is not linked into any executable: it
+// is compiled to assembly at release flags and `check_codegen.py` verifies the `// CHECK:` lines
+// against the probe defined right below them. See `check_codegen.py` for the available checks.
+
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#include "StaticVector.hpp"
+
+using Vec = StaticVector<std::int32_t, 64UZ>;
+
+extern "C" {
+
+// -------------------------------------------------------------------------------------------------
+// CHECK: no-call
+// CHECK: no-loop
+// CHECK: max-instructions 8
+void probe_push_back(Vec& vec, std::int32_t value) { vec.push_back(value); }
+
+// CHECK: no-call
+// CHECK: max-instructions 2
+auto probe_index(const Vec& vec, size_t idx) -> std::int32_t { return vec[idx]; }
+
+// CHECK: no-call
+// CHECK: max-instructions 2
+auto probe_size(const Vec& vec) -> size_t { return vec.size(); }
+
+// A trivially destructible element type must not leave a loop over the elements behind.
+// CHECK: no-call
+// CHECK: no-loop
+// CHECK: max-instructions 1
+void probe_destroy(Vec* vec) { std::destroy_at(vec); }
+
+// -------------------------------------------------------------------------------------------------
+// Depending on the tuning, the bulk copy is a call to `memcpy` or inlined as `rep movs`, but never
+// a loop over the elements.
+// CHECK: only-calls memcpy
+// CHECK: no-loop
+void probe_copy(Vec* dst, const Vec& src) { ::new (dst) Vec(src); }
+
+// CHECK: vector-loop
+void probe_fill(Vec* dst, size_t size, std::int32_t value) { ::new (dst) Vec(size, value); }
+
+}  // extern "C"
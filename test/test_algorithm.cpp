@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Algorithm.hpp"
+#include "StaticVector.hpp"
+
+using namespace std::string_literals;
+
+// Values around zero and at the limits of the type, so that signed and unsigned comparisons differ.
+template <typename Element>
+[[nodiscard]] auto interesting_value(size_t i) -> Element {
+  using Limits = std::numeric_limits<Element>;
+  switch (i % 7UZ) {
+    case 0UZ: return Limits::lowest();
+    case 1UZ: return Limits::max();
+    case 2UZ: return static_cast<Element>(0);
+    case 3UZ: return static_cast<Element>(1);
+    case 4UZ: return static_cast<Element>(-1);
+    case 5UZ: return static_cast<Element>(i % 5UZ);
+    default:  return static_cast<Element>(i / 7UZ);
+  }
+}
+
+// Compare every kernel against the scalar algorithm for all sizes of the vector. The storage behind
+// the size is filled with the searched values first, the kernels must not report them.
+template <typename Element, size_t CAPACITY, typename Op>
+void expect_same_as_scalar() {
+  for (size_t size = 0; size <= CAPACITY; ++size) {
+    StaticVector<Element, CAPACITY> vec(CAPACITY, interesting_value<Element>(2UZ));
+    vec.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+      vec[i] = interesting_value<Element>(i * 3UZ + size);
+    }
+
+    for (size_t v = 0; v < 7UZ; ++v) {
+      const auto value = interesting_value<Element>(v);
+      const auto pred  = compare_with<Op>(value);
+      const auto naive = [&](const Element& e) { return Op{}(e, value); };
+
+      EXPECT_EQ(find_if(vec, pred), std::find_if(vec.begin(), vec.end(), naive))
+          << "size = " << size << ", value = " << +value;
+      EXPECT_EQ(count_if(vec, pred),
+                static_cast<size_t>(std::count_if(vec.begin(), vec.end(), naive)))
+          << "size = " << size << ", value = " << +value;
+    }
+  }
+}
+
+// Erases with every kernel from every size of the vector, compared to `std::remove_if`.
+template <typename Element, size_t CAPACITY, typename Op>
+void expect_erased_like_scalar() {
+  for (size_t size = 0; size <= CAPACITY; ++size) {
+    StaticVector<Element, CAPACITY> vec;
+    for (size_t i = 0; i < size; ++i) {
+      vec.push_back(interesting_value<Element>(i * 3UZ + size));
+    }
+
+    for (size_t v = 0; v < 7UZ; ++v) {
+      const auto value = interesting_value<Element>(v);
+      const auto naive = [&](const Element& e) { return Op{}(e, value); };
+      auto expected    = vec;
+      expected.erase(std::remove_if(expected.begin(), expected.end(), naive), expected.end());
+
+      auto erased = vec;
+      EXPECT_EQ(erase_if(erased, compare_with<Op>(value)), vec.size() - expected.size());
+      ASSERT_TRUE(std::equal(erased.begin(), erased.end(), expected.begin(), expected.end()))
+          << "size = " << size << ", value = " << +value;
+
+      erased = vec;
+      erase_if(erased, naive);
+      ASSERT_TRUE(std::equal(erased.begin(), erased.end(), expected.begin(), expected.end()))
+          << "size = " << size << ", value = " << +value;
+    }
+  }
+}
+
+template <typename Element>
+void expect_same_as_scalar_for_all_comparisons() {
+  expect_same_as_scalar<Element, 64UZ, std::equal_to<>>();
+  expect_same_as_scalar<Element, 64UZ, std::not_equal_to<>>();
+  expect_same_as_scalar<Element, 64UZ, std::less<>>();
+  expect_same_as_scalar<Element, 64UZ, std::less_equal<>>();
+  expect_same_as_scalar<Element, 64UZ, std::greater<>>();
+  expect_same_as_scalar<Element, 64UZ, std::greater_equal<Element>>();
+  // Capacity is not a multiple of the vector width.
+  expect_same_as_scalar<Element, 67UZ, std::equal_to<Element>>();
+  expect_same_as_scalar<Element, 67UZ, std::less<>>();
+  expect_same_as_scalar<Element, 3UZ, std::equal_to<>>();
+
+  expect_erased_like_scalar<Element, 64UZ, std::equal_to<>>();
+  expect_erased_like_scalar<Element, 64UZ, std::less<>>();
+  expect_erased_like_scalar<Element, 67UZ, std::greater_equal<>>();
+  expect_erased_like_scalar<Element, 67UZ, std::not_equal_to<>>();
+  expect_erased_like_scalar<Element, 3UZ, std::equal_to<>>();
+}
+
+// Sorts every size up to the capacity of shuffled values with duplicates, compared to std::sort.
+template <typename Element, size_t CAPACITY, typename Compare>
+void expect_sorted_like_std() {
+  std::mt19937 rng(42);  // NOLINT
+  for (size_t size = 0; size <= CAPACITY; ++size) {
+    StaticVector<Element, CAPACITY> vec;
+    for (size_t i = 0; i < size; ++i) {
+      vec.push_back(interesting_value<Element>(i));
+    }
+    std::shuffle(vec.begin(), vec.end(), rng);
+    auto expected = vec;
+    std::sort(expected.begin(), expected.end(), Compare{});
+
+    auto sorted = vec;
+    sort(sorted, Compare{});
+    ASSERT_TRUE(std::equal(sorted.begin(), sorted.end(), expected.begin(), expected.end()))
+        << "size = " << size;
+    stable_sort(vec, Compare{});
+    ASSERT_TRUE(std::equal(vec.begin(), vec.end(), expected.begin(), expected.end()))
+        << "size = " << size;
+  }
+}
+
+// Number of comparators of the network for `N` elements.
+template <size_t N>
+[[nodiscard]] consteval auto comparator_count() -> size_t {
+  size_t res = 0UZ;
+  for (const auto& block : detail::network::BLOCKS<N>) {
+    res += block.length;
+  }
+  return res;
+}
+
+// Batcher's networks for powers of two.
+static_assert(comparator_count<1UZ>() == 0UZ);
+static_assert(comparator_count<2UZ>() == 1UZ);
+static_assert(comparator_count<8UZ>() == 19UZ);
+static_assert(comparator_count<16UZ>() == 63UZ);
+static_assert(comparator_count<64UZ>() == 543UZ);
+
+// -------------------------------------------------------------------------------------------------
+TEST(Algorithm, FindCountContains) {
+  StaticVector<std::uint32_t, 64UZ> vec{5, 3, 8, 3, 1};
+  EXPECT_EQ(find(vec, 3U), vec.begin() + 1);
+  EXPECT_EQ(find(vec, 4U), vec.end());
+  EXPECT_EQ(count(vec, 3U), 2UZ);
+  EXPECT_EQ(count(vec, 4U), 0UZ);
+  EXPECT_TRUE(contains(vec, 1U));
+  EXPECT_FALSE(contains(vec, 0U));
+
+  *find(vec, 8U) = 4U;
+  EXPECT_TRUE(contains(vec, 4U));
+
+  const auto& cvec = vec;
+  EXPECT_EQ(find_if(cvec, compare_with<std::greater<>>(4U)), cvec.begin());
+  EXPECT_EQ(find_if(cvec, compare_with<std::less<>>(3U)), cvec.begin() + 4);
+  EXPECT_EQ(count_if(cvec, compare_with<std::less_equal<>>(3U)), 3UZ);
+
+  const StaticVector<std::uint32_t, 64UZ> empty{};
+  EXPECT_EQ(find(empty, 0U), empty.end());
+  EXPECT_FALSE(contains(empty, 0U));
+
+  const StaticVector<std::uint32_t, 0UZ> zero{};
+  EXPECT_EQ(find(zero, 0U), zero.end());
+  EXPECT_EQ(count(zero, 0U), 0UZ);
+
+  // The value converts to the element type like with `std::ranges::find`.
+  EXPECT_TRUE(contains(vec, 5));
+  EXPECT_EQ(find(vec, 1), vec.begin() + 4);
+  const StaticVector<float, 8UZ> floats{0.0F, 1.5F, 0.0F};
+  EXPECT_EQ(count(floats, 0), 2UZ);
+}
+
+TEST(Algorithm, SameAsScalar) {
+  expect_same_as_scalar_for_all_comparisons<std::int8_t>();
+  expect_same_as_scalar_for_all_comparisons<std::uint8_t>();
+  expect_same_as_scalar_for_all_comparisons<std::int16_t>();
+  expect_same_as_scalar_for_all_comparisons<std::uint16_t>();
+  expect_same_as_scalar_for_all_comparisons<std::int32_t>();
+  expect_same_as_scalar_for_all_comparisons<std::uint32_t>();
+  expect_same_as_scalar_for_all_comparisons<std::int64_t>();
+  expect_same_as_scalar_for_all_comparisons<std::uint64_t>();
+  expect_same_as_scalar_for_all_comparisons<float>();
+  expect_same_as_scalar_for_all_comparisons<double>();
+}
+
+TEST(Algorithm, NaN) {
+  constexpr auto NaN = std::numeric_limits<double>::quiet_NaN();
+  StaticVector<double, 16UZ> vec{1.0, NaN, -0.0};
+
+  EXPECT_FALSE(contains(vec, NaN));
+  EXPECT_EQ(find(vec, 0.0), vec.begin() + 2);
+  EXPECT_EQ(count_if(vec, compare_with<std::not_equal_to<>>(1.0)), 2UZ);
+  EXPECT_EQ(count_if(vec, compare_with<std::greater_equal<>>(-1.0)), 2UZ);
+  EXPECT_EQ(count_if(vec, compare_with<std::less<>>(NaN)), 0UZ);
+}
+
+TEST(Algorithm, ScalarFallback) {
+  StaticVector<std::string, 8UZ> strings{"a"s, "b"s, "c"s, "b"s};
+  EXPECT_EQ(find(strings, "b"s), strings.begin() + 1);
+  EXPECT_EQ(count(strings, "b"s), 2UZ);
+  EXPECT_FALSE(contains(strings, "d"s));
+  EXPECT_EQ(count_if(strings, compare_with<std::greater<>>("a"s)), 3UZ);
+
+  // Neither a comparison with a value of another type nor an arbitrary predicate is vectorized.
+  StaticVector<int, 8UZ> ints{1, 2, 3, 4};
+  EXPECT_EQ(count_if(ints, compare_with<std::less<>>(2.5)), 2UZ);
+  EXPECT_EQ(find_if(ints, [](int i) { return i % 2 == 0; }), ints.begin() + 1);
+}
+
+TEST(Algorithm, ConstantEvaluation) {
+  constexpr auto result = [] {
+    StaticVector<int, 8UZ> vec{4, 1, 3, 1};
+    return count(vec, 1) * 100UZ + static_cast<size_t>(find(vec, 3) - vec.begin()) * 10UZ +
+           static_cast<size_t>(contains(vec, 5));
+  }();
+  static_assert(result == 220UZ);
+}
+
+TEST(Algorithm, Erase) {
+  StaticVector<std::int32_t, 32UZ> ints{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+  EXPECT_EQ(erase(ints, 5), 3UZ);
+  EXPECT_EQ(erase(ints, 7), 0UZ);
+  EXPECT_EQ(std::vector(ints.begin(), ints.end()), (std::vector{3, 1, 4, 1, 9, 2, 6, 3}));
+  EXPECT_EQ(erase_if(ints, [](std::int32_t i) { return i % 3 == 0; }), 4UZ);
+  EXPECT_EQ(std::vector(ints.begin(), ints.end()), (std::vector{1, 4, 1, 2}));
+
+  StaticVector<float, 8UZ> floats{0.0F, 1.5F, 0.0F};
+  EXPECT_EQ(erase(floats, 0), 2UZ);
+  EXPECT_EQ(std::vector(floats.begin(), floats.end()), std::vector{1.5F});
+
+  StaticVector<std::string, 8UZ> strings{"a"s, "bb"s, "a"s, "ccc"s};
+  EXPECT_EQ(erase(strings, "a"s), 2UZ);
+  EXPECT_EQ(erase_if(strings, [](const std::string& s) { return s.size() > 2UZ; }), 1UZ);
+  EXPECT_EQ(std::vector(strings.begin(), strings.end()), std::vector{"bb"s});
+
+  constexpr auto erased = [] {
+    StaticVector<int, 8UZ> vec{1, 2, 3, 2, 1};
+    return (erase(vec, 2) * 10UZ) + erase_if(vec, compare_with<std::less<>>(2)) + vec.size();
+  }();
+  static_assert(erased == 20UZ + 2UZ + 1UZ);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Algorithm, Sort) {
+  expect_sorted_like_std<std::int8_t, 70UZ, std::less<>>();
+  expect_sorted_like_std<std::uint16_t, 33UZ, std::greater<>>();
+  expect_sorted_like_std<std::int32_t, 64UZ, std::less<std::int32_t>>();
+  expect_sorted_like_std<std::uint64_t, 20UZ, std::greater<std::uint64_t>>();
+  expect_sorted_like_std<float, 64UZ, std::less<>>();
+  expect_sorted_like_std<double, 100UZ, std::greater<>>();
+  // Predicates that are not sorted by a network.
+  expect_sorted_like_std<std::int32_t, 40UZ, std::less<std::int64_t>>();
+  expect_sorted_like_std<std::int32_t, 40UZ, decltype([](int a, int b) { return a < b; })>();
+
+  StaticVector<std::string, 8UZ> strings{"c"s, "a"s, "b"s};
+  sort(strings);
+  EXPECT_TRUE(std::is_sorted(strings.begin(), strings.end()));
+  EXPECT_EQ(strings.back(), "c"s);
+
+  StaticVector<int, 0UZ> zero;
+  sort(zero);
+  EXPECT_TRUE(zero.empty());
+}
+
+TEST(Algorithm, SortSignedZeroAndInfinity) {
+  // Equivalent elements are never duplicated.
+  constexpr auto INF = std::numeric_limits<double>::infinity();
+  StaticVector<double, 8UZ> vec{0.0, INF, -0.0, 1.0, -INF};
+  sort(vec);
+  EXPECT_EQ(vec[0], -INF);
+  EXPECT_EQ(vec[3], 1.0);
+  EXPECT_EQ(vec[4], INF);
+  EXPECT_NE(std::signbit(vec[1]), std::signbit(vec[2]));
+
+  sort(vec, std::greater{});
+  EXPECT_EQ(vec[0], INF);
+  EXPECT_EQ(vec[4], -INF);
+}
+
+TEST(Algorithm, StableSort) {
+  using Entry = std::pair<int, int>;
+  const auto by_first = [](const Entry& a, const Entry& b) { return a.first < b.first; };
+
+  // Small vectors are sorted by insertion, large ones by std::stable_sort.
+  for (const auto size : {10UZ, 50UZ}) {
+    StaticVector<Entry, 64UZ> vec;
+    for (size_t i = 0; i < size; ++i) {
+      vec.emplace_back(static_cast<int>((i * 7UZ) % 4UZ), static_cast<int>(i));
+    }
+    stable_sort(vec, by_first);
+    EXPECT_TRUE(std::is_sorted(vec.begin(), vec.end()));
+  }
+}
+
+TEST(Algorithm, SortConstantEvaluation) {
+  constexpr auto sorted = [] {
+    StaticVector<int, 16UZ> vec{5, -3, 9, 0, 5, 12, -7};
+    sort(vec);
+    StaticVector<double, 4UZ> doubles{0.5, -1.0, 2.0};
+    stable_sort(doubles, std::greater{});
+    return vec[0] == -7 && vec[3] == 5 && vec[6] == 12 && doubles[0] == 2.0;
+  }();
+  static_assert(sorted);
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentStaticVector.hpp"
+
+using namespace std::string_literals;
+
+namespace {
+
+// Runs `f(thread_idx)` on `thread_count` threads that start at the same time.
+template <typename F>
+void run_threads(size_t thread_count, F f) {
+  std::atomic<bool> start = false;
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count);
+  for (size_t t = 0; t < thread_count; ++t) {
+    threads.emplace_back([&, t] {
+      while (!start.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      f(t);
+    });
+  }
+  start.store(true, std::memory_order_release);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+TEST(ConcurrentVector, SingleThread) {
+  ConcurrentStaticVector<std::string, 3UZ> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.capacity(), 3UZ);
+
+  auto* a = vec.try_push_back("a"s);
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(*a, "a"s);
+  const auto b = "b"s;
+  vec.push_back(b);
+  vec.emplace_back(2UZ, 'c');
+  EXPECT_EQ(vec.try_emplace_back("d"), nullptr);
+  EXPECT_EQ(vec.size(), 3UZ);
+  EXPECT_TRUE(vec.is_published(2UZ));
+
+  const auto view = vec.view();
+  ASSERT_EQ(view.size(), 3UZ);
+  EXPECT_EQ(view[0], "a"s);
+  EXPECT_EQ(view[2], "cc"s);
+  EXPECT_EQ(vec.published().size(), 3UZ);
+
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+  EXPECT_FALSE(vec.is_published(0UZ));
+  EXPECT_NE(vec.try_push_back("e"s), nullptr);
+  EXPECT_EQ(vec.view().front(), "e"s);
+
+  // Only the leading elements that fit are appended.
+  const std::string values[] = {"f"s, "g"s, "h"s};  // NOLINT
+  EXPECT_EQ(vec.try_append(values, 3UZ), 2UZ);
+  EXPECT_EQ(vec.view().back(), "g"s);
+  EXPECT_EQ(vec.try_append(values, 1UZ), 0UZ);
+}
+
+TEST(ConcurrentVector, StressAllFit) {
+  constexpr size_t THREADS          = 8UZ;
+  constexpr size_t ITEMS_PER_THREAD = 2000UZ;
+  using Vec = ConcurrentStaticVector<std::uint64_t, THREADS * ITEMS_PER_THREAD>;
+  auto vec  = std::make_unique<Vec>();
+
+  for (int round = 0; round < 3; ++round) {
+    run_threads(THREADS, [&](size_t t) {
+      for (size_t i = 0; i < ITEMS_PER_THREAD; ++i) {
+        // Readers may look at the published prefix while writers are active.
+        if (i % 256UZ == 0UZ) {
+          const auto prefix = vec->published();
+          EXPECT_LE(prefix.size(), vec->size());
+        }
+        vec->push_back((t * ITEMS_PER_THREAD) + i);
+      }
+    });
+
+    // Every value was appended exactly once.
+    const auto view = vec->view();
+    auto values     = std::vector<std::uint64_t>(view.begin(), view.end());
+    ASSERT_EQ(values.size(), THREADS * ITEMS_PER_THREAD);
+    std::ranges::sort(values);
+    for (size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(values[i], i);
+    }
+    vec->clear();
+  }
+}
+
+TEST(ConcurrentVector, StressAppend) {
+  constexpr size_t THREADS  = 8UZ;
+  constexpr size_t BATCHES  = 500UZ;
+  constexpr size_t CAPACITY = 10000UZ;
+  using Vec                 = ConcurrentStaticVector<std::uint32_t, CAPACITY>;
+  auto vec                  = std::make_unique<Vec>();
+
+  std::atomic<size_t> accepted = 0UZ;
+  run_threads(THREADS, [&](size_t t) {
+    for (size_t b = 0; b < BATCHES; ++b) {
+      // Batches of three, all elements of a batch hold the same value.
+      const auto value            = static_cast<std::uint32_t>((t * BATCHES) + b);
+      const std::uint32_t batch[] = {value, value, value};  // NOLINT
+      accepted.fetch_add(vec->try_append(batch, 3UZ), std::memory_order_relaxed);
+    }
+  });
+
+  // The last batch that fits is cut short, all other batches are contiguous.
+  EXPECT_EQ(accepted.load(), CAPACITY);
+  const auto view = vec->view();
+  ASSERT_EQ(view.size(), CAPACITY);
+  for (size_t i = 0; i + 3UZ <= (CAPACITY / 3UZ) * 3UZ; i += 3UZ) {
+    ASSERT_EQ(view[i], view[i + 1UZ]);
+    ASSERT_EQ(view[i], view[i + 2UZ]);
+  }
+}
+
+TEST(ConcurrentVector, StressOverflow) {
+  constexpr size_t THREADS          = 8UZ;
+  constexpr size_t ITEMS_PER_THREAD = 1000UZ;
+  constexpr size_t CAPACITY         = 3000UZ;
+  auto counter                      = std::make_shared<int>(0);
+  {
+    ConcurrentStaticVector<std::shared_ptr<int>, CAPACITY> vec;
+    std::atomic<size_t> accepted = 0UZ;
+    run_threads(THREADS, [&](size_t /*t*/) {
+      for (size_t i = 0; i < ITEMS_PER_THREAD; ++i) {
+        if (vec.try_push_back(counter) != nullptr) {
+          accepted.fetch_add(1UZ, std::memory_order_relaxed);
+        }
+      }
+    });
+
+    // The vector is filled exactly, the rejected elements were not constructed.
+    EXPECT_EQ(accepted.load(), CAPACITY);
+    EXPECT_EQ(vec.size(), CAPACITY);
+    EXPECT_EQ(vec.view().size(), CAPACITY);
+    EXPECT_EQ(counter.use_count(), static_cast<long>(CAPACITY) + 1L);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+#include "StaticVector.hpp"
+
+// Vectors of non-trivial elements during constant evaluation: every `static_assert` below fails to
+// compile if an operation is not a constant expression.
+
+namespace {
+
+// Counts the live instances in `*alive`, which a constant expression can only do if every
+// constructor and destructor call is evaluated.
+struct Counted {
+  int* alive;
+  int value;
+
+  constexpr Counted(int* alive_, int value_) noexcept
+      : alive(alive_),
+        value(value_) {
+    ++*alive;
+  }
+  constexpr Counted(const Counted& other) noexcept
+      : alive(other.alive),
+        value(other.value) {
+    ++*alive;
+  }
+  constexpr Counted(Counted&& other) noexcept
+      : alive(other.alive),
+        value(std::exchange(other.value, 0)) {
+    ++*alive;
+  }
+  constexpr auto operator=(const Counted& other) noexcept -> Counted& = default;
+  constexpr auto operator=(Counted&& other) noexcept -> Counted& {
+    value = std::exchange(other.value, 0);
+    return *this;
+  }
+  constexpr ~Counted() noexcept { --*alive; }
+};
+
+static_assert(!StaticVector<Counted, 4UZ>::constructor_and_destructor_are_cheap);
+static_assert(!StaticVector<std::string, 4UZ>::constructor_and_destructor_are_cheap);
+
+// -------------------------------------------------------------------------------------------------
+// push_back and pop_back construct and destroy exactly one element.
+static_assert([] {
+  int alive = 0;
+  {
+    StaticVector<Counted, 4UZ> vec;
+    vec.push_back(Counted{&alive, 1});
+    vec.emplace_back(&alive, 2);
+    vec.emplace_back(&alive, 3);
+    if (alive != 3 || vec.back().value != 3) { return false; }
+
+    vec.pop_back();
+    if (alive != 2 || vec.size() != 2UZ || vec.back().value != 2) { return false; }
+  }
+  return alive == 0;
+}());
+
+// Copies own their elements and the destructor destroys all of them.
+static_assert([] {
+  int alive = 0;
+  {
+    StaticVector<Counted, 4UZ> a;
+    a.emplace_back(&alive, 1);
+    a.emplace_back(&alive, 2);
+
+    const StaticVector<Counted, 4UZ> b = a;
+    StaticVector<Counted, 8UZ> c(b);
+    if (alive != 6) { return false; }
+
+    c = std::move(a);
+    if (alive != 6 || c[1].value != 2 || a[1].value != 0) { return false; }
+
+    a.clear();
+    if (alive != 4) { return false; }
+  }
+  return alive == 0;
+}());
+
+// Inserting and erasing in the middle shift the elements behind the position.
+static_assert([] {
+  int alive = 0;
+  int sum   = 0;
+  {
+    StaticVector<Counted, 8UZ> vec;
+    for (int i = 1; i <= 4; ++i) {
+      vec.emplace_back(&alive, i);
+    }
+    vec.insert(vec.begin() + 1, Counted{&alive, 10});
+    vec.erase(vec.begin() + 3);
+    vec.erase(vec.begin() + 3, vec.end());
+    for (const auto& e : vec) {
+      sum += e.value;
+    }
+    if (alive != 3) { return false; }
+  }
+  return alive == 0 && sum == 1 + 10 + 2;
+}());
+
+// Standard library types that allocate, which must all be freed before the evaluation ends.
+static_assert([] {
+  StaticVector<std::string, 4UZ> vec{"routing", "table"};
+  vec.emplace_back(64UZ, 'x');
+  const auto copy = vec;
+  vec.pop_back();
+  vec.insert(vec.begin(), "static");
+  return vec.size() == 3UZ && vec.front() == "static" && copy.back().size() == 64UZ;
+}());
+
+// -------------------------------------------------------------------------------------------------
+// Lookup tables computed at compile time. Spare storage of cheap elements is initialized during
+// constant evaluation, so a table does not have to be full.
+struct Route {
+  int prefix;
+  int port;
+};
+
+constexpr auto ROUTES = [] {
+  StaticVector<Route, 16UZ> routes;
+  for (int i = 0; i < 5; ++i) {
+    routes.push_back(Route{.prefix = i << 8, .port = i % 2});
+  }
+  return routes;
+}();
+static_assert(ROUTES.size() == 5UZ && ROUTES.back().prefix == 4 << 8);
+
+// A constant of a type with a non-trivial destructor has to initialize all of its storage, so the
+// vector must be full.
+struct Name {
+  char first;
+  constexpr explicit Name(char c) noexcept : first(c) {}
+  constexpr ~Name() noexcept {}  // NOLINT(modernize-use-equals-default)
+};
+
+constexpr auto NAMES = [] {
+  StaticVector<Name, 3UZ> names;
+  names.emplace_back('a');
+  names.emplace_back('b');
+  names.emplace_back('c');
+  return names;
+}();
+static_assert(NAMES.size() == 3UZ && NAMES[2].first == 'c');
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+TEST(Constexpr, TablesAreUsableAtRunTime) {
+  int ports = 0;
+  for (const auto& route : ROUTES) {
+    ports += route.port;
+  }
+  EXPECT_EQ(ports, 2);
+  EXPECT_EQ(NAMES[0].first, 'a');
+}
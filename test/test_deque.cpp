@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "StaticDeque.hpp"
+
+using namespace std::string_literals;
+
+static_assert(std::random_access_iterator<StaticDeque<int, 8UZ>::iterator>);
+static_assert(std::random_access_iterator<StaticDeque<int, 8UZ>::const_iterator>);
+static_assert(std::ranges::random_access_range<StaticDeque<std::string, 5UZ>>);
+static_assert(std::ranges::sized_range<StaticDeque<std::string, 5UZ>>);
+
+// Head and size fill the tail padding of the storage.
+static_assert(sizeof(StaticDeque<std::uint16_t, 7UZ>) == 16UZ);
+
+// Wrapping a power of two capacity masks, other capacities subtract once.
+static_assert(detail::ring_index<8UZ>(13UZ) == 5UZ);
+static_assert(detail::ring_index<6UZ>(7UZ) == 1UZ);
+static_assert(detail::ring_index<6UZ>(5UZ) == 5UZ);
+
+template <typename Deque>
+[[nodiscard]] auto to_vector(const Deque& deque) {
+  return std::vector<typename Deque::value_type>(deque.begin(), deque.end());
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Deque, PushPop) {
+  StaticDeque<int, 4UZ> deque;
+  EXPECT_TRUE(deque.empty());
+  deque.push_back(2);
+  deque.push_front(1);
+  deque.emplace_back(3);
+  deque.emplace_front(0);
+  EXPECT_TRUE(deque.full());
+  EXPECT_EQ(to_vector(deque), (std::vector{0, 1, 2, 3}));
+  EXPECT_EQ(deque.front(), 0);
+  EXPECT_EQ(deque.back(), 3);
+  EXPECT_EQ(deque[2], 2);
+
+  EXPECT_EQ(deque.pop_front(), 0);
+  EXPECT_EQ(deque.pop_back(), 3);
+  EXPECT_EQ(to_vector(deque), (std::vector{1, 2}));
+  deque.clear();
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(Deque, SlidingWindow) {
+  // Non power of two capacity, the elements wrap around many times.
+  StaticDeque<int, 5UZ> window;
+  int sum = 0;
+  for (int i = 0; i < 100; ++i) {
+    if (window.full()) { sum -= window.pop_front(); }
+    window.push_back(i);
+    sum += i;
+    ASSERT_EQ(sum, std::accumulate(window.begin(), window.end(), 0));
+  }
+  EXPECT_EQ(to_vector(window), (std::vector{95, 96, 97, 98, 99}));
+
+  StaticDeque<int, 8UZ> reverse_window;
+  for (int i = 0; i < 20; ++i) {
+    if (reverse_window.full()) { reverse_window.pop_back(); }
+    reverse_window.push_front(i);
+  }
+  EXPECT_EQ(to_vector(reverse_window), (std::vector{19, 18, 17, 16, 15, 14, 13, 12}));
+}
+
+TEST(Deque, Iterator) {
+  StaticDeque<int, 4UZ> deque{2, 3};
+  deque.push_front(1);
+  deque.push_front(0);
+
+  auto it = deque.begin();
+  EXPECT_EQ(*(it + 3), 3);
+  EXPECT_EQ(it[1], 1);
+  EXPECT_EQ(deque.end() - deque.begin(), 4);
+  EXPECT_LT(it, deque.end());
+  EXPECT_EQ(--(++it), deque.begin());
+
+  StaticDeque<int, 4UZ>::const_iterator cit = deque.begin();
+  EXPECT_EQ(cit, deque.cbegin());
+  EXPECT_EQ(std::distance(cit, deque.cend()), 4);
+
+  EXPECT_EQ(std::vector(deque.rbegin(), deque.rend()), (std::vector{3, 2, 1, 0}));
+  std::ranges::sort(deque, std::greater{});
+  EXPECT_EQ(to_vector(deque), (std::vector{3, 2, 1, 0}));
+  EXPECT_EQ(std::ranges::find(std::as_const(deque), 1) - deque.cbegin(), 2);
+}
+
+TEST(Deque, Segments) {
+  StaticDeque<std::uint8_t, 8UZ> deque;
+  const std::uint8_t bytes[] = {1, 2, 3, 4, 5, 6};  // NOLINT
+  deque.append(bytes, 6UZ);
+  deque.drop_front(4UZ);
+
+  // [5, 6, 7, 8] up to the end of the storage, [9, 10] wrapped around to the beginning.
+  const std::uint8_t more[] = {7, 8, 9, 10};  // NOLINT
+  deque.append(more, 4UZ);
+  const auto [first, second] = deque.segments();
+  EXPECT_EQ(first.size(), 4UZ);
+  EXPECT_EQ(first.data(), &deque.front());
+  EXPECT_EQ(second.size(), 2UZ);
+  EXPECT_EQ(second.back(), 10);
+
+  // Bulk copy out.
+  std::uint8_t out[6] = {};  // NOLINT
+  size_t offset       = 0UZ;
+  for (const auto segment : std::as_const(deque).segments()) {
+    std::memcpy(out + offset, segment.data(), segment.size());
+    offset += segment.size();
+  }
+  EXPECT_EQ(std::vector(std::begin(out), std::end(out)),
+            (std::vector<std::uint8_t>{5, 6, 7, 8, 9, 10}));
+
+  deque.clear();
+  EXPECT_TRUE(deque.segments()[0].empty());
+  EXPECT_TRUE(deque.segments()[1].empty());
+}
+
+TEST(Deque, NonDefaultConstructible) {
+  struct Value {
+    explicit Value(std::string s)
+        : str(std::move(s)) {}
+    std::string str;
+  };
+  static_assert(!std::is_default_constructible_v<Value>);
+
+  StaticDeque<Value, 3UZ> deque;
+  deque.emplace_back("b"s);
+  deque.emplace_front("a"s);
+  deque.emplace_back("A string that does not fit into the small string buffer"s);
+  EXPECT_EQ(deque.pop_front().str, "a"s);
+  deque.emplace_back("c"s);
+  EXPECT_EQ(deque.back().str, "c"s);
+}
+
+TEST(Deque, CopyMoveAndDestruction) {
+  auto counter = std::make_shared<int>(0);
+  {
+    StaticDeque<std::shared_ptr<int>, 4UZ> deque;
+    deque.push_back(counter);
+    deque.push_back(counter);
+    deque.push_back(counter);
+    deque.pop_front();
+    deque.push_back(counter);
+    deque.push_back(counter);  // Wraps around.
+    EXPECT_EQ(counter.use_count(), 5);
+
+    auto copy = deque;
+    EXPECT_EQ(counter.use_count(), 9);
+    EXPECT_EQ(copy.segments()[1].size(), 0UZ);
+
+    auto moved = std::move(copy);
+    EXPECT_EQ(counter.use_count(), 9);
+    copy = moved;
+    EXPECT_EQ(counter.use_count(), 13);
+    copy.drop_front(3UZ);
+    EXPECT_EQ(counter.use_count(), 10);
+    moved = std::move(copy);
+    EXPECT_EQ(counter.use_count(), 6);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(Deque, ConstantEvaluation) {
+  constexpr auto sum = [] {
+    StaticDeque<int, 3UZ> deque;
+    for (int i = 1; i <= 10; ++i) {
+      if (deque.full()) { deque.pop_front(); }
+      deque.push_back(i);
+    }
+    return std::accumulate(deque.begin(), deque.end(), 0);
+  }();
+  static_assert(sum == 8 + 9 + 10);
+  EXPECT_EQ(sum, 27);
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "StaticFlatMap.hpp"
+#include "StaticFlatSet.hpp"
+
+using namespace std::string_literals;
+
+static_assert(std::random_access_iterator<StaticFlatMap<int, std::string, 8UZ>::iterator>);
+static_assert(std::random_access_iterator<StaticFlatMap<int, std::string, 8UZ>::const_iterator>);
+static_assert(std::ranges::random_access_range<StaticFlatMap<int, std::string, 8UZ>>);
+static_assert(std::ranges::contiguous_range<StaticFlatSet<int, 8UZ>>);
+
+template <typename Range>
+[[nodiscard]] auto to_vector(const Range& range) {
+  return std::vector<std::ranges::range_value_t<Range>>(std::ranges::begin(range),
+                                                        std::ranges::end(range));
+}
+
+// Lower bound of every key between the stored ones, against std::lower_bound.
+template <typename Key, size_t CAPACITY, typename Compare>
+void expect_lower_bounds(const StaticFlatSet<Key, CAPACITY, Compare>& set, Key first, Key last) {
+  for (Key key = first; key != last; ++key) {
+    const auto expected = std::lower_bound(set.begin(), set.end(), key, Compare{});
+    ASSERT_EQ(set.lower_bound(key), expected) << "key " << +key << ", size " << set.size();
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(FlatSet, InsertFindErase) {
+  StaticFlatSet<int, 8UZ> set{5, 1, 3};
+  EXPECT_EQ(to_vector(set), (std::vector{1, 3, 5}));
+  EXPECT_TRUE(set.insert(4).second);
+  EXPECT_FALSE(set.insert(3).second);
+  EXPECT_EQ(*set.insert(0).first, 0);
+  EXPECT_EQ(to_vector(set), (std::vector{0, 1, 3, 4, 5}));
+
+  EXPECT_TRUE(set.contains(4));
+  EXPECT_FALSE(set.contains(2));
+  EXPECT_EQ(set.find(2), set.end());
+  EXPECT_EQ(set.find(3) - set.begin(), 2);
+  EXPECT_EQ(set.count(5), 1UZ);
+
+  EXPECT_EQ(set.erase(3), 1UZ);
+  EXPECT_EQ(set.erase(3), 0UZ);
+  EXPECT_EQ(*set.erase(set.begin()), 1);
+  EXPECT_EQ(to_vector(set), (std::vector{1, 4, 5}));
+  set.clear();
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(FlatSet, LowerBound) {
+  // Vectorized linear search in a small set, binary search beyond the threshold and in a set of
+  // strings, each in ascending and descending order.
+  StaticFlatSet<std::uint8_t, 200UZ> bytes;
+  StaticFlatSet<std::int64_t, 200UZ, std::greater<>> descending;
+  for (std::uint8_t i = 0; i < 200U; ++i) {
+    expect_lower_bounds(bytes, std::uint8_t{0}, std::uint8_t{255});
+    expect_lower_bounds(descending, std::int64_t{-1}, std::int64_t{1000});
+    bytes.insert(static_cast<std::uint8_t>((i * 7U) % 251U));
+    descending.emplace(i * 3);
+  }
+  EXPECT_EQ(bytes.size(), 200UZ);
+  EXPECT_TRUE(std::ranges::is_sorted(descending, std::greater{}));
+
+  StaticFlatSet<std::string, 4UZ> strings{"b"s, "d"s};
+  EXPECT_EQ(strings.lower_bound("a"s), strings.begin());
+  EXPECT_EQ(*strings.lower_bound("c"s), "d"s);
+  EXPECT_EQ(strings.lower_bound("e"s), strings.end());
+}
+
+TEST(FlatSet, AssignSorted) {
+  StaticFlatSet<float, 16UZ> set{1.0F};
+  const std::vector keys{-1.5F, 0.0F, 2.5F, 8.0F};
+  set.assign_sorted(keys);
+  EXPECT_EQ(to_vector(set), keys);
+  EXPECT_TRUE(set.contains(2.5F));
+  EXPECT_FALSE(set.contains(1.0F));
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(FlatMap, InsertFindErase) {
+  StaticFlatMap<int, std::string, 8UZ> map{{3, "c"s}, {1, "a"s}};
+  EXPECT_EQ(to_vector(map.keys()), (std::vector{1, 3}));
+  EXPECT_EQ(to_vector(map.values()), (std::vector{"a"s, "c"s}));
+
+  const auto [it, inserted] = map.try_emplace(2, 3UZ, 'b');
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(std::get<1>(*it), "bbb"s);
+  EXPECT_FALSE(map.try_emplace(2, "x"s).second);
+  EXPECT_FALSE(map.insert({1, "x"s}).second);
+  EXPECT_EQ(map.at(2), "bbb"s);
+
+  EXPECT_FALSE(map.insert_or_assign(2, "b"s).second);
+  EXPECT_TRUE(map.insert_or_assign(0, "zero"s).second);
+  map[4] = "A string that does not fit into the small string buffer"s;
+  EXPECT_EQ(map[5], ""s);
+  EXPECT_EQ(to_vector(map.keys()), (std::vector{0, 1, 2, 3, 4, 5}));
+  EXPECT_EQ(map.at(2), "b"s);
+
+  EXPECT_TRUE(map.contains(4));
+  EXPECT_EQ(map.count(6), 0UZ);
+  EXPECT_EQ(map.find(6), map.end());
+  EXPECT_EQ(std::get<0>(*map.lower_bound(-1)), 0);
+
+  EXPECT_EQ(map.erase(0), 1UZ);
+  EXPECT_EQ(map.erase(0), 0UZ);
+  const auto next = map.erase(map.find(2));
+  EXPECT_EQ(std::get<0>(*next), 3);
+  EXPECT_EQ(to_vector(map.keys()), (std::vector{1, 3, 4, 5}));
+  EXPECT_EQ(map.values()[1], "c"s);
+  EXPECT_EQ(map.values()[2], "A string that does not fit into the small string buffer"s);
+}
+
+TEST(FlatMap, Iterator) {
+  StaticFlatMap<std::uint32_t, double, 8UZ> map{{2U, 2.0}, {1U, 1.0}, {3U, 3.0}};
+  for (auto [key, value] : map) {
+    value *= key;
+  }
+  EXPECT_EQ(to_vector(map.values()), (std::vector{1.0, 4.0, 9.0}));
+
+  const auto& cmap = map;
+  EXPECT_EQ(std::ranges::distance(cmap), 3);
+  EXPECT_EQ(std::get<1>(*cmap.find(2U)), 4.0);
+  EXPECT_EQ(cmap.at(3U), 9.0);
+
+  // Keys are not assignable through the iterators.
+  using Reference = std::iter_reference_t<decltype(map.begin())>;
+  static_assert(std::is_same_v<std::tuple_element_t<0, Reference>, const std::uint32_t&>);
+}
+
+TEST(FlatMap, AgainstStdMap) {
+  std::mt19937 rng(42);  // NOLINT
+  std::uniform_int_distribution<std::int32_t> dist(0, 99);
+
+  StaticFlatMap<std::int32_t, std::int32_t, 64UZ> map;
+  std::map<std::int32_t, std::int32_t> reference;
+  for (int i = 0; i < 2000; ++i) {
+    const auto key = dist(rng);
+    if (reference.size() < 64UZ && dist(rng) < 60) {
+      EXPECT_EQ(map.insert_or_assign(key, i).second, reference.insert_or_assign(key, i).second);
+    } else {
+      EXPECT_EQ(map.erase(key), reference.erase(key));
+    }
+    ASSERT_EQ(map.size(), reference.size());
+    ASSERT_TRUE(std::ranges::equal(map.keys(), reference | std::views::keys));
+    ASSERT_TRUE(std::ranges::equal(map.values(), reference | std::views::values));
+  }
+}
+
+TEST(FlatMap, AssignSorted) {
+  StaticFlatMap<std::uint16_t, std::string, 4UZ> map{{7U, "x"s}};
+  const std::uint16_t keys[] = {1U, 2U, 3U};  // NOLINT
+  const std::string values[] = {"a"s, "b"s, "c"s};  // NOLINT
+  map.assign_sorted(keys, values);
+  EXPECT_EQ(map.size(), 3UZ);
+  EXPECT_EQ(map.at(2U), "b"s);
+  EXPECT_FALSE(map.contains(7U));
+}
+
+TEST(FlatMap, Destruction) {
+  auto counter = std::make_shared<int>(0);
+  {
+    StaticFlatMap<int, std::shared_ptr<int>, 4UZ> map;
+    map.try_emplace(1, counter);
+    map.try_emplace(0, counter);
+    map.try_emplace(1, counter);
+    EXPECT_EQ(counter.use_count(), 3);
+    auto copy = map;
+    EXPECT_EQ(counter.use_count(), 5);
+    copy.erase(0);
+    EXPECT_EQ(counter.use_count(), 4);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(FlatMap, ConstantEvaluation) {
+  constexpr auto sum = [] {
+    StaticFlatMap<int, int, 8UZ> map{{4, 40}, {2, 20}};
+    map[3] = 30;
+    map.erase(4);
+    int res = 0;
+    for (const auto [key, value] : map) {
+      res += key + value;
+    }
+    return res;
+  }();
+  static_assert(sum == 2 + 20 + 3 + 30);
+  EXPECT_EQ(sum, 55);
+}
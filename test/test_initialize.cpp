@@ -469,3 +469,90 @@ TEST(Initialize, EmplaceBack) {
     EXPECT_EQ(vec.size(), 4);
   }
 }
+
+// -------------------------------------------------------------------------------------------------
+TEST(Initialize, TriviallyCopyableCopyAndMove) {
+  static_assert(std::is_trivially_copyable_v<std::array<double, 3>>);
+
+  StaticVector<std::array<double, 3>, 8UZ> v1;
+  for (size_t i = 0; i < 5UZ; ++i) {
+    const auto d = static_cast<double>(i);
+    v1.push_back({d, 2.0 * d, 3.0 * d});
+  }
+
+  const auto check = [](const auto& vec) {
+    ASSERT_EQ(vec.size(), 5UZ);
+    for (size_t i = 0; i < vec.size(); ++i) {
+      const auto d = static_cast<double>(i);
+      EXPECT_DOUBLE_EQ(vec[i][0], d);
+      EXPECT_DOUBLE_EQ(vec[i][1], 2.0 * d);
+      EXPECT_DOUBLE_EQ(vec[i][2], 3.0 * d);
+    }
+  };
+
+  {
+    const StaticVector<std::array<double, 3>, 8UZ> v2 = v1;  // NOLINT
+    check(v2);
+  }
+  {
+    const StaticVector<std::array<double, 3>, 16UZ> v2 = v1;
+    check(v2);
+  }
+  {
+    StaticVector<std::array<double, 3>, 5UZ> v2{{1.0, 1.0, 1.0}};
+    v2 = v1;
+    check(v2);
+  }
+  {
+    auto tmp                                       = v1;
+    const StaticVector<std::array<double, 3>, 8UZ> v2 = std::move(tmp);
+    check(v2);
+  }
+  {
+    auto tmp = v1;
+    StaticVector<std::array<double, 3>, 32UZ> v2{{1.0, 1.0, 1.0}, {2.0, 2.0, 2.0}};
+    v2 = std::move(tmp);
+    check(v2);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Initialize, ConvertingCopy) {
+  const StaticVector<int, 8UZ> v1{1, 2, 3, 4};
+
+  const StaticVector<double, 4UZ> v2 = v1;
+  ASSERT_EQ(v2.size(), 4UZ);
+  for (size_t i = 0; i < v2.size(); ++i) {
+    EXPECT_DOUBLE_EQ(v2[i], static_cast<double>(i + 1));
+  }
+
+  StaticVector<long, 16UZ> v3{42L};
+  v3 = v1;
+  ASSERT_EQ(v3.size(), 4UZ);
+  for (size_t i = 0; i < v3.size(); ++i) {
+    EXPECT_EQ(v3[i], static_cast<long>(i + 1));
+  }
+
+  constexpr auto constexpr_copy = [] {
+    StaticVector<int, 4UZ> a{1, 2, 3};
+    const StaticVector<int, 4UZ> b = a;
+    const StaticVector<long, 8UZ> c = b;
+    return c[0] + c[1] + c[2];
+  }();
+  static_assert(constexpr_copy == 6);
+}
+
+// -------------------------------------------------------------------------------------------------
+// A vector without capacity has no storage, its `data()` is a null pointer.
+TEST(Initialize, FromZeroCapacity) {
+  StaticVector<int, 0UZ> zero;
+  const StaticVector<int, 4UZ> copied = zero;
+  EXPECT_TRUE(copied.empty());
+
+  const StaticVector<int, 4UZ> moved{std::move(zero)};
+  EXPECT_TRUE(moved.empty());
+
+  StaticVector<int, 4UZ> assigned{1, 2};
+  assigned = StaticVector<int, 0UZ>{};
+  EXPECT_TRUE(assigned.empty());
+}
@@ -0,0 +1,96 @@
+// Statistics are recorded for this test only, it has to be defined before any header of the
+// library is included.
+#ifndef SV_INSTRUMENTATION
+#define SV_INSTRUMENTATION
+#endif
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <string>
+
+#include "StaticVector.hpp"
+
+namespace {
+
+// Report of the instantiation for `Element` with `CAPACITY`, which must have been used.
+template <typename Element, size_t CAPACITY>
+[[nodiscard]] auto report_of() -> CapacityReport {
+  const auto reports = capacity_reports();
+  const auto it      = std::ranges::find_if(reports, [](const CapacityReport& r) {
+    return r.element == detail::instrument::type_name<Element>() && r.capacity == CAPACITY;
+  });
+  EXPECT_NE(it, reports.end());
+  return it != reports.end() ? *it : CapacityReport{};
+}
+
+}  // namespace
+
+static_assert(detail::instrument::type_name<int>() == "int");
+
+// -------------------------------------------------------------------------------------------------
+TEST(Instrumentation, PushPopAndHighWaterMark) {
+  {
+    StaticVector<int, 16UZ> a;
+    for (int i = 0; i < 5; ++i) {
+      a.push_back(i);
+    }
+    a.pop_back();
+    a.pop_back();
+
+    StaticVector<int, 16UZ> b;
+    b.emplace_back(1);
+    b.resize(9UZ);
+  }
+
+  const auto report = report_of<int, 16UZ>();
+  EXPECT_EQ(report.element_size, sizeof(int));
+  EXPECT_EQ(report.pushes, 6UZ);
+  EXPECT_EQ(report.pops, 2UZ);
+  EXPECT_EQ(report.high_water_mark, 9UZ);
+  EXPECT_EQ(report.recommended_capacity, 9UZ);
+  EXPECT_EQ(report.near_full, 0UZ);
+  EXPECT_EQ(report.overflows, 0UZ);
+
+  // Sizes 1 to 5 after the pushes, 4 and 3 after the pops, in buckets of two elements.
+  const std::array<size_t, 8> histogram{2UZ, 3UZ, 3UZ, 0UZ, 0UZ, 0UZ, 0UZ, 0UZ};
+  EXPECT_EQ(report.size_histogram, histogram);
+}
+
+TEST(Instrumentation, NearFullAndOverflow) {
+  StaticVector<std::string, 8UZ> vec;
+  for (int i = 0; i < 8; ++i) {
+    vec.push_back(std::to_string(i));
+  }
+  EXPECT_EQ(vec.try_push_back("overflow"), nullptr);
+
+  const auto report = report_of<std::string, 8UZ>();
+  EXPECT_EQ(report.high_water_mark, 8UZ);
+  EXPECT_EQ(report.near_full, 2UZ);
+  EXPECT_EQ(report.overflows, 1UZ);
+  EXPECT_EQ(report.recommended_capacity, 16UZ);
+}
+
+TEST(Instrumentation, ConstantEvaluationIsNotRecorded) {
+  constexpr auto size = [] {
+    StaticVector<long, 4UZ> vec;
+    vec.push_back(1L);
+    return vec.size();
+  }();
+  static_assert(size == 1UZ);
+
+  const auto reports = capacity_reports();
+  EXPECT_TRUE(std::ranges::none_of(reports, [](const CapacityReport& r) {
+    return r.element == detail::instrument::type_name<long>();
+  }));
+}
+
+TEST(Instrumentation, Print) {
+  StaticVector<double, 32UZ> vec(3UZ);
+  std::ostringstream out;
+  print_capacity_report(out);
+  EXPECT_NE(out.str().find("StaticVector<double, 32>: high-water mark 3, recommended capacity 3"),
+            std::string::npos);
+}
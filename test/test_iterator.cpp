@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <iterator>
+#include <ranges>
 #include <string>
+#include <vector>
 
 using namespace std::string_literals;
 
@@ -31,6 +33,26 @@ static_assert(
     std::random_access_iterator<decltype(std::declval<StaticVector<std::string, 16>>().crbegin())>,
     "Const ReverseIterator must be random access iterator.");
 
+static_assert(std::ranges::contiguous_range<StaticVector<int, 16>>);
+static_assert(std::ranges::contiguous_range<const StaticVector<int, 16>>);
+static_assert(std::ranges::sized_range<StaticVector<int, 16>>);
+static_assert(std::ranges::contiguous_range<StaticVector<std::string, 16>>);
+static_assert(std::ranges::sized_range<StaticVector<std::string, 16>>);
+static_assert(std::ranges::contiguous_range<StaticVector<int, 0>>);
+
+static_assert(std::same_as<StaticVector<int, 16>::reverse_iterator::iterator_concept,
+                           std::random_access_iterator_tag>);
+static_assert(
+    std::same_as<std::iterator_traits<StaticVector<int, 16>::reverse_iterator>::iterator_category,
+                 std::random_access_iterator_tag>);
+static_assert(std::sized_sentinel_for<StaticVector<int, 16>::reverse_iterator,
+                                      StaticVector<int, 16>::reverse_iterator>);
+static_assert(std::ranges::random_access_range<
+              std::ranges::subrange<StaticVector<int, 16>::const_reverse_iterator>>);
+static_assert(std::sortable<StaticVector<int, 16>::reverse_iterator>);
+static_assert(std::convertible_to<StaticVector<int, 16>::reverse_iterator,
+                                  StaticVector<int, 16>::const_reverse_iterator>);
+
 TEST(Iterator, ForwardIterator) {
   {
     StaticVector<int, 16UZ> vec{3, 4, 5, 1, 2, 3, 9, 8, 5, 1001};
@@ -106,6 +128,29 @@ TEST(Iterator, ModifyReverseIterator) {
   }
 }
 
+TEST(Iterator, ReverseIteratorOrder) {
+  StaticVector<int, 16UZ> vec{1, 2, 3, 4, 5};
+
+  EXPECT_EQ(vec.rbegin().base(), vec.end());
+  EXPECT_EQ(vec.rend().base(), vec.begin());
+  EXPECT_LT(vec.rbegin(), vec.rend());
+  EXPECT_GT(vec.crend(), vec.crbegin());
+  EXPECT_EQ(vec.rbegin()[1], 4);
+  EXPECT_EQ(*(vec.crbegin() + 4), 1);
+  EXPECT_EQ(*(vec.crend() - 1), 1);
+
+  const StaticVector<int, 16UZ>::const_reverse_iterator crbegin = vec.rbegin();
+  EXPECT_EQ(crbegin, vec.crbegin());
+
+  EXPECT_TRUE(std::ranges::equal(std::ranges::subrange(vec.rbegin(), vec.rend()),
+                                 std::vector{5, 4, 3, 2, 1}));
+  EXPECT_TRUE(std::ranges::equal(std::views::reverse(vec), std::vector{5, 4, 3, 2, 1}));
+
+  StaticVector<int, 16UZ> empty;
+  EXPECT_EQ(empty.rbegin(), empty.rend());
+  EXPECT_EQ(empty.crbegin(), empty.crend());
+}
+
 TEST(Iterator, Distance) {
   StaticVector<std::string, 32> vec(32);
 
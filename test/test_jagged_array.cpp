@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "StaticJaggedArray.hpp"
+
+using namespace std::string_literals;
+
+static_assert(std::random_access_iterator<StaticJaggedVector<int, 4UZ, 16UZ>::iterator>);
+static_assert(std::random_access_iterator<StaticJaggedVector<int, 4UZ, 16UZ>::const_iterator>);
+static_assert(std::ranges::random_access_range<const StaticJaggedArray<int, 4UZ, 16UZ>>);
+static_assert(std::ranges::contiguous_range<StaticJaggedArray<int, 4UZ, 16UZ>::reference>);
+// The offsets are stored in the narrowest type that can hold the total capacity.
+static_assert(sizeof(StaticJaggedArray<std::uint32_t, 1024UZ, 4096UZ>) ==
+              (4096UZ * 4UZ) + (1025UZ * 2UZ) + 2UZ);
+
+// The arrays are usable during constant evaluation, also with non-trivial elements.
+static_assert([] {
+  StaticJaggedVector<std::string, 3UZ, 8UZ> rows{{"a", "b"}, {}};
+  rows.push_row();
+  rows.push_back("c");
+  rows.pop_row();
+  rows.push_row({"d"});
+  return rows.size() == 3UZ && rows.total_size() == 3UZ && rows[2][0] == "d";
+}());
+
+template <typename Range>
+[[nodiscard]] auto to_vectors(const Range& rows) {
+  using Element = std::ranges::range_value_t<std::ranges::range_value_t<Range>>;
+  std::vector<std::vector<std::remove_cv_t<Element>>> res;
+  for (const auto row : rows) {
+    res.emplace_back(row.begin(), row.end());
+  }
+  return res;
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(JaggedVector, BuildRows) {
+  StaticJaggedVector<int, 4UZ, 8UZ> rows;
+  EXPECT_TRUE(rows.empty());
+  rows.push_row({1, 2, 3});
+  rows.push_row();
+  rows.push_row(std::views::iota(4, 6));
+  rows.push_row();
+  rows.push_back(6);
+  rows.emplace_back(7);
+  EXPECT_TRUE(rows.full());
+
+  EXPECT_EQ(to_vectors(rows), (std::vector<std::vector<int>>{{1, 2, 3}, {}, {4, 5}, {6, 7}}));
+  EXPECT_EQ(rows.total_size(), 7UZ);
+  EXPECT_EQ(to_vectors(std::views::single(rows.elements())),
+            (std::vector<std::vector<int>>{{1, 2, 3, 4, 5, 6, 7}}));
+  EXPECT_EQ(std::vector<std::uint8_t>(rows.offsets().begin(), rows.offsets().end()),
+            (std::vector<std::uint8_t>{0, 3, 3, 5, 7}));
+
+  // Rows offer the read API of StaticVector.
+  const auto row = rows[0];
+  EXPECT_EQ(row.size(), 3UZ);
+  EXPECT_EQ(row.front(), 1);
+  EXPECT_EQ(row.back(), 3);
+  EXPECT_EQ(std::vector<int>(row.rbegin(), row.rend()), (std::vector<int>{3, 2, 1}));
+  EXPECT_TRUE(rows[1].empty());
+
+  // Elements are modified in place.
+  rows[2][1] = 50;
+  rows.back().front() = 60;
+  EXPECT_EQ(to_vectors(rows), (std::vector<std::vector<int>>{{1, 2, 3}, {}, {4, 50}, {60, 7}}));
+}
+
+TEST(JaggedVector, IterateRows) {
+  const StaticJaggedVector<int, 8UZ, 16UZ> rows{{1}, {2, 3}, {}, {4, 5, 6}};
+  EXPECT_EQ(rows.end() - rows.begin(), 4);
+  EXPECT_EQ(rows.begin()[3].size(), 3UZ);
+  EXPECT_EQ(to_vectors(std::ranges::subrange(rows.rbegin(), rows.rend())),
+            (std::vector<std::vector<int>>{{4, 5, 6}, {}, {2, 3}, {1}}));
+  size_t total = 0UZ;
+  for (const auto row : rows) {
+    total += row.size();
+  }
+  EXPECT_EQ(total, rows.total_size());
+}
+
+TEST(JaggedVector, PopRowAndClear) {
+  const auto p = std::make_shared<int>(1);
+  {
+    StaticJaggedVector<std::shared_ptr<int>, 4UZ, 8UZ> rows;
+    rows.push_row({p, p});
+    rows.push_row({p, p, p});
+    EXPECT_EQ(p.use_count(), 6);
+    rows.pop_row();
+    EXPECT_EQ(p.use_count(), 3);
+    EXPECT_EQ(rows.size(), 1UZ);
+
+    auto copy = rows;
+    EXPECT_EQ(p.use_count(), 5);
+    EXPECT_EQ(copy, rows);
+    rows.clear();
+    EXPECT_EQ(p.use_count(), 3);
+    EXPECT_NE(copy, rows);
+
+    rows = std::move(copy);
+    EXPECT_EQ(rows[0].size(), 2UZ);
+  }
+  EXPECT_EQ(p.use_count(), 1);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(JaggedArray, RowsThatWereNotBuiltAreEmpty) {
+  StaticJaggedArray<std::string, 4UZ, 8UZ>::Builder builder;
+  builder.push_row({"a"s, "b"s});
+  builder.push_row();
+  builder.push_back("a string that does not fit into the small string buffer"s);
+  const StaticJaggedArray<std::string, 4UZ, 8UZ> array{std::move(builder)};
+
+  EXPECT_EQ(array.size(), 4UZ);
+  EXPECT_EQ(to_vectors(array),
+            (std::vector<std::vector<std::string>>{
+                {"a", "b"}, {"a string that does not fit into the small string buffer"}, {}, {}}));
+  EXPECT_EQ(array.total_size(), 3UZ);
+
+  const StaticJaggedArray<int, 3UZ, 4UZ> empty;
+  EXPECT_TRUE(std::ranges::all_of(empty, [](auto row) { return row.empty(); }));
+  EXPECT_EQ(empty, (StaticJaggedArray<int, 3UZ, 4UZ>{{}, {}}));
+  EXPECT_NE(empty, (StaticJaggedArray<int, 3UZ, 4UZ>{{}, {1}}));
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "StaticVector.hpp"
+
+// - Size type -------------------------------------------------------------------------------------
+static_assert(std::is_same_v<detail::SizeType<0UZ>, std::uint8_t>);
+static_assert(std::is_same_v<detail::SizeType<255UZ>, std::uint8_t>);
+static_assert(std::is_same_v<detail::SizeType<256UZ>, std::uint16_t>);
+static_assert(std::is_same_v<detail::SizeType<65'535UZ>, std::uint16_t>);
+static_assert(std::is_same_v<detail::SizeType<65'536UZ>, std::uint32_t>);
+static_assert(std::is_same_v<detail::SizeType<4'294'967'295UZ>, std::uint32_t>);
+static_assert(std::is_same_v<detail::SizeType<4'294'967'296UZ>, std::uint64_t>);
+
+// - Footprint -------------------------------------------------------------------------------------
+static_assert(sizeof(StaticVector<std::uint8_t, 15UZ>) == 16UZ);
+static_assert(sizeof(StaticVector<std::uint8_t, 31UZ>) == 32UZ);
+static_assert(sizeof(StaticVector<std::uint8_t, 255UZ>) == 256UZ);
+static_assert(sizeof(StaticVector<std::uint8_t, 256UZ>) == 258UZ);
+static_assert(sizeof(StaticVector<char, 7UZ>) == 8UZ);
+// Beyond 255 elements the size is wider than the element and sets the alignment of the vector.
+static_assert(alignof(StaticVector<char, 300UZ>) == alignof(std::uint16_t));
+static_assert(sizeof(StaticVector<char, 300UZ>) == 302UZ);
+static_assert(sizeof(StaticVector<char, 301UZ>) == 304UZ);
+static_assert(alignof(StaticVector<char, 70'000UZ>) == alignof(std::uint32_t));
+
+static_assert(sizeof(StaticVector<std::uint16_t, 7UZ>) == 16UZ);
+static_assert(sizeof(StaticVector<std::uint16_t, 1024UZ>) == 2050UZ);
+
+static_assert(sizeof(StaticVector<int, 3UZ>) == 16UZ);
+static_assert(sizeof(StaticVector<int, 8UZ>) == 36UZ);
+static_assert(sizeof(StaticVector<float, 16UZ>) == 68UZ);
+static_assert(sizeof(StaticVector<int, 1024UZ>) == 4100UZ);
+
+static_assert(sizeof(StaticVector<double, 4UZ>) == 40UZ);
+static_assert(sizeof(StaticVector<std::string, 4UZ>) == 4UZ * sizeof(std::string) + 8UZ);
+static_assert(sizeof(StaticVector<std::array<std::uint8_t, 3>, 5UZ>) == 16UZ);
+
+// The size never adds more than the tail padding required by the element alignment.
+template <typename Element, size_t CAPACITY>
+constexpr auto has_minimal_footprint() -> bool {
+  constexpr auto payload = CAPACITY * sizeof(Element) + sizeof(detail::SizeType<CAPACITY>);
+  constexpr auto align   = alignof(StaticVector<Element, CAPACITY>);
+  return sizeof(StaticVector<Element, CAPACITY>) == (payload + align - 1UZ) / align * align;
+}
+static_assert(has_minimal_footprint<std::uint8_t, 1UZ>());
+static_assert(has_minimal_footprint<std::uint8_t, 100UZ>());
+static_assert(has_minimal_footprint<std::int16_t, 300UZ>());
+static_assert(has_minimal_footprint<int, 5UZ>());
+static_assert(has_minimal_footprint<double, 100'000UZ>());
+static_assert(has_minimal_footprint<std::string, 16UZ>());
+
+// - Zero capacity ---------------------------------------------------------------------------------
+static_assert(std::is_empty_v<StaticVector<int, 0UZ>>);
+static_assert(std::is_empty_v<StaticVector<std::string, 0UZ>>);
+static_assert(std::is_trivially_copyable_v<StaticVector<std::string, 0UZ>>);
+static_assert(sizeof(StaticVector<double, 0UZ>) == 1UZ);
+// The alignment policy applies, the element alignment does not.
+static_assert(std::is_empty_v<StaticVector<int, 0UZ, CacheLineIsolated>>);
+static_assert(alignof(StaticVector<int, 0UZ, CacheLineIsolated>) == CACHE_LINE_SIZE);
+static_assert(sizeof(std::array<StaticVector<char, 0UZ, CacheLineIsolated>, 4UZ>) ==
+              4UZ * CACHE_LINE_SIZE);
+static_assert(alignof(StaticVector<float, 0UZ, SimdAligned>) == SIMD_WIDTH);
+
+// - Alignment policies ----------------------------------------------------------------------------
+static_assert(std::is_same_v<StaticVector<int, 8UZ>, StaticVector<int, 8UZ, ElementAligned>>);
+static_assert(alignof(StaticVector<int, 8UZ, ElementAligned>) == alignof(int));
+
+static_assert(alignof(detail::UninitializedArray<float, 8UZ, SimdAligned>) == SIMD_WIDTH);
+static_assert(alignof(StaticVector<float, 8UZ, SimdAligned>) == SIMD_WIDTH);
+static_assert(sizeof(StaticVector<float, 8UZ, SimdAligned>) % SIMD_WIDTH == 0UZ);
+static_assert(alignof(StaticVector<std::uint8_t, 3UZ, AlignedTo<32UZ>>) == 32UZ);
+static_assert(sizeof(StaticVector<std::uint8_t, 3UZ, AlignedTo<32UZ>>) == 32UZ);
+// The element alignment wins if it is stricter than the policy.
+static_assert(alignof(StaticVector<double, 4UZ, AlignedTo<2UZ>>) == alignof(double));
+
+// Cache line isolated vectors occupy whole cache lines, also when the size spills into a new line.
+static_assert(alignof(StaticVector<int, 4UZ, CacheLineIsolated>) == CACHE_LINE_SIZE);
+static_assert(sizeof(StaticVector<int, 4UZ, CacheLineIsolated>) == CACHE_LINE_SIZE);
+static_assert(sizeof(StaticVector<int, 16UZ, CacheLineIsolated>) == 2UZ * CACHE_LINE_SIZE);
+static_assert(sizeof(StaticVector<std::string, 3UZ, CacheLineIsolated>) % CACHE_LINE_SIZE == 0UZ);
+static_assert(sizeof(std::array<StaticVector<char, 1UZ, CacheLineIsolated>, 4UZ>) ==
+              4UZ * CACHE_LINE_SIZE);
+
+// -------------------------------------------------------------------------------------------------
+TEST(Layout, ZeroCapacity) {
+  struct S {
+    [[no_unique_address]] StaticVector<std::string, 0UZ> vec;
+    int i;
+  };
+  static_assert(sizeof(S) == sizeof(int));
+
+  StaticVector<std::string, 0UZ> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.size(), 0UZ);
+  EXPECT_EQ(vec.capacity(), 0UZ);
+  EXPECT_EQ(vec.begin(), vec.end());
+  EXPECT_EQ(vec.rbegin(), vec.rend());
+
+  size_t count = 0UZ;
+  for ([[maybe_unused]] const auto& e : vec) {
+    count += 1UZ;
+  }
+  EXPECT_EQ(count, 0UZ);
+
+  const StaticVector<std::string, 4UZ> other = vec;
+  EXPECT_TRUE(other.empty());
+
+  std::array<StaticVector<int, 0UZ, CacheLineIsolated>, 3UZ> per_thread{};
+  for (const auto& isolated : per_thread) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&isolated) % CACHE_LINE_SIZE, 0UZ);  // NOLINT
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Layout, SizeAtCapacityBoundary) {
+  StaticVector<std::uint8_t, 255UZ> vec;
+  for (size_t i = 0; i < vec.capacity(); ++i) {
+    vec.push_back(static_cast<std::uint8_t>(i));
+  }
+  EXPECT_EQ(vec.size(), 255UZ);
+  EXPECT_EQ(vec.back(), 254);
+
+  const auto copy = vec;
+  EXPECT_EQ(copy.size(), 255UZ);
+
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Layout, AlignmentPolicies) {
+  std::array<StaticVector<int, 4UZ, CacheLineIsolated>, 3UZ> per_thread{};
+  for (const auto& vec : per_thread) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&vec) % CACHE_LINE_SIZE, 0UZ);  // NOLINT
+  }
+
+  StaticVector<float, 32UZ, SimdAligned> simd{1.0F, 2.0F};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(simd.data()) % SIMD_WIDTH, 0UZ);  // NOLINT
+
+  // Vectors with different policies convert into each other.
+  StaticVector<float, 8UZ> plain = simd;
+  EXPECT_EQ(plain.size(), 2UZ);
+  EXPECT_EQ(plain[1], 2.0F);
+  simd = std::move(plain);
+  EXPECT_EQ(simd.size(), 2UZ);
+  const StaticVector<float, 0UZ, CacheLineIsolated> zero{};
+  plain = zero;
+  EXPECT_TRUE(plain.empty());
+}
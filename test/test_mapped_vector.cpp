@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "MappedStaticVector.hpp"
+
+namespace {
+
+struct Record {
+  std::uint32_t id;
+  std::uint16_t port;
+  std::uint8_t flags;
+};
+
+using RecordVector  = StaticVector<Record, 6UZ>;
+using MappedRecords = MappedStaticVectors<Record, 6UZ>;
+
+static_assert(detail::MappableVector<Record, 6UZ, ElementAligned>);
+static_assert(detail::MappableVector<double, 4UZ, CacheLineIsolated>);
+static_assert(!detail::MappableVector<std::string, 4UZ, ElementAligned>);
+
+// Removes the file when leaving the test.
+class TempFile {
+  std::string m_path;
+
+ public:
+  explicit TempFile(const char* name)
+      : m_path((std::filesystem::temp_directory_path() / name).string()) {}
+  TempFile(const TempFile&)                    = delete;
+  auto operator=(const TempFile&) -> TempFile& = delete;
+  ~TempFile() { std::filesystem::remove(m_path); }
+
+  [[nodiscard]] auto path() const noexcept -> const char* { return m_path.c_str(); }
+};
+
+[[nodiscard]] auto make_records(size_t count) -> std::vector<RecordVector> {
+  std::vector<RecordVector> vectors(count);
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t j = 0; j < i % 7UZ; ++j) {
+      vectors[i].push_back(Record{.id    = static_cast<std::uint32_t>((i * 10UZ) + j),
+                                  .port  = static_cast<std::uint16_t>(j),
+                                  .flags = static_cast<std::uint8_t>(i)});
+    }
+  }
+  return vectors;
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------------------------------------
+TEST(MappedVector, RoundTrip) {
+  const TempFile file("sv_test_round_trip.bin");
+  const auto vectors = make_records(1000UZ);
+  ASSERT_TRUE(write_static_vectors(file.path(), vectors).has_value());
+
+  const auto mapped = MappedRecords::open(file.path());
+  ASSERT_TRUE(mapped.has_value());
+  ASSERT_EQ(mapped->size(), vectors.size());
+  for (size_t i = 0; i < vectors.size(); ++i) {
+    const RecordVector& vec = (*mapped)[i];
+    ASSERT_EQ(vec.size(), vectors[i].size());
+    for (size_t j = 0; j < vec.size(); ++j) {
+      EXPECT_EQ(vec[j].id, vectors[i][j].id);
+      EXPECT_EQ(vec[j].port, vectors[i][j].port);
+      EXPECT_EQ(vec[j].flags, vectors[i][j].flags);
+    }
+  }
+
+  // The stored vectors are plain StaticVectors, so they can be copied out.
+  const RecordVector copy = mapped->vectors().back();
+  EXPECT_EQ(copy.size(), vectors.back().size());
+}
+
+TEST(MappedVector, EmptyAndAligned) {
+  const TempFile file("sv_test_aligned.bin");
+  using Vector = StaticVector<double, 4UZ, CacheLineIsolated>;
+  using Mapped = MappedStaticVectors<double, 4UZ, CacheLineIsolated>;
+  ASSERT_TRUE(write_static_vectors(file.path(), std::vector<Vector>{}).has_value());
+
+  auto mapped = Mapped::open(file.path());
+  ASSERT_TRUE(mapped.has_value());
+  EXPECT_TRUE(mapped->empty());
+  EXPECT_EQ(mapped->begin(), mapped->end());
+
+  const std::vector<Vector> vectors{Vector{1.0, 2.0}, Vector{}, Vector{3.0, 4.0, 5.0, 6.0}};
+  ASSERT_TRUE(write_static_vectors(file.path(), vectors).has_value());
+  *mapped = std::move(Mapped::open(file.path())).value();
+  ASSERT_EQ(mapped->size(), 3UZ);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped->begin()) % CACHE_LINE_SIZE, 0UZ);  // NOLINT
+  EXPECT_EQ((*mapped)[1].size(), 0UZ);
+  EXPECT_DOUBLE_EQ((*mapped)[2].back(), 6.0);
+}
+
+// Spare elements are written as zeros, so the file only depends on the values.
+TEST(MappedVector, SpareStorageIsZeroed) {
+  const TempFile file("sv_test_zeroed.bin");
+  std::vector<StaticVector<std::uint32_t, 4UZ>> vectors(1UZ);
+  vectors[0].push_back(7U);
+  vectors[0].push_back(8U);
+  vectors[0].push_back(9U);
+  vectors[0].pop_back();
+  ASSERT_TRUE(write_static_vectors(file.path(), vectors).has_value());
+
+  std::ifstream in(file.path(), std::ios::binary);
+  std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  ASSERT_EQ(bytes.size(), 56UZ + sizeof(vectors[0]));
+  std::uint32_t elements[4];  // NOLINT
+  std::memcpy(elements, bytes.data() + 56, sizeof(elements));
+  EXPECT_EQ(elements[0], 7U);
+  EXPECT_EQ(elements[1], 8U);
+  EXPECT_EQ(elements[2], 0U);
+  EXPECT_EQ(elements[3], 0U);
+}
+
+// The padding of the vector is written as zeros as well, whatever the memory of the vector holds.
+TEST(MappedVector, PaddingIsZeroed) {
+  using Vector = StaticVector<std::uint8_t, 301UZ, CacheLineIsolated>;
+  using Mapped = MappedStaticVectors<std::uint8_t, 301UZ, CacheLineIsolated>;
+  static_assert(sizeof(Vector) == 320UZ);
+  const TempFile file("sv_test_padding.bin");
+
+  alignas(Vector) std::byte memory[sizeof(Vector)];  // NOLINT
+  std::memset(memory, 0xAB, sizeof(memory));
+  auto* vec = ::new (memory) Vector();
+  vec->push_back(1U);
+  vec->push_back(2U);
+  ASSERT_TRUE(write_static_vectors(file.path(), std::span{vec, 1UZ}).has_value());
+
+  std::ifstream in(file.path(), std::ios::binary);
+  std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  const auto offset = detail::file_data_offset<Vector>();
+  ASSERT_EQ(bytes.size(), offset + sizeof(Vector));
+  EXPECT_EQ(bytes[offset], 1);
+  EXPECT_EQ(bytes[offset + 1UZ], 2);
+  // The size is stored in two bytes at offset 302, all other bytes are zero.
+  std::uint16_t size = 0U;
+  std::memcpy(&size, bytes.data() + offset + 302UZ, sizeof(size));
+  EXPECT_EQ(size, 2U);
+  for (size_t i = 2UZ; i < sizeof(Vector); ++i) {
+    if (i != 302UZ && i != 303UZ) { EXPECT_EQ(bytes[offset + i], 0) << "at byte " << i; }
+  }
+
+  const auto mapped = Mapped::open(file.path());
+  ASSERT_TRUE(mapped.has_value());
+  ASSERT_EQ((*mapped)[0].size(), 2UZ);
+  EXPECT_EQ((*mapped)[0][1], 2U);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(MappedVector, Errors) {
+  const TempFile file("sv_test_errors.bin");
+  EXPECT_EQ(MappedRecords::open(file.path()).error(), FileError::OPEN);
+
+  ASSERT_TRUE(write_static_vectors(file.path(), make_records(10UZ)).has_value());
+  EXPECT_TRUE(MappedRecords::open(file.path()).has_value());
+  EXPECT_EQ((MappedStaticVectors<Record, 7UZ>::open(file.path()).error()), FileError::LAYOUT);
+  EXPECT_EQ((MappedStaticVectors<std::uint64_t, 6UZ>::open(file.path()).error()),
+            FileError::LAYOUT);
+
+  // Overwrites `size` bytes at `offset`.
+  const auto patch = [&](long offset, const void* data, size_t size) {
+    std::FILE* f = std::fopen(file.path(), "r+b");
+    ASSERT_NE(f, nullptr);
+    std::fseek(f, offset, SEEK_SET);
+    std::fwrite(data, 1UZ, size, f);
+    std::fclose(f);
+  };
+
+  const std::uint32_t version = STATIC_VECTOR_FILE_VERSION + 1U;
+  patch(8, &version, sizeof(version));
+  EXPECT_EQ(MappedRecords::open(file.path()).error(), FileError::VERSION);
+
+  patch(0, "NOTSVEC", 8UZ);
+  EXPECT_EQ(MappedRecords::open(file.path()).error(), FileError::FORMAT);
+
+  // Truncated files do not match the count in the header.
+  ASSERT_TRUE(write_static_vectors(file.path(), make_records(10UZ)).has_value());
+  std::filesystem::resize_file(file.path(), std::filesystem::file_size(file.path()) - 1UZ);
+  EXPECT_EQ(MappedRecords::open(file.path()).error(), FileError::FORMAT);
+  std::filesystem::resize_file(file.path(), 20UZ);
+  EXPECT_EQ(MappedRecords::open(file.path()).error(), FileError::FORMAT);
+}
@@ -0,0 +1,550 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "StaticVector.hpp"
+
+using namespace std::string_literals;
+
+// A type that owns a heap pointer: it can be relocated with `memmove` but it is not trivially
+// copyable.
+struct Boxed {
+  std::unique_ptr<int> ptr;
+
+  Boxed(int i)
+      : ptr(std::make_unique<int>(i)) {}
+
+  [[nodiscard]] auto value() const noexcept -> int { return *ptr; }
+};
+
+template <>
+struct detail::is_trivially_relocatable<Boxed> : std::true_type {};
+
+template <typename Vec, typename Expected>
+void expect_elements(const Vec& vec, const Expected& expected) {
+  ASSERT_EQ(vec.size(), expected.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(vec[i], expected[i]) << "at index " << i;
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, InsertSingle) {
+  {
+    StaticVector<int, 16UZ> vec{1, 2, 3};
+    auto it = vec.insert(vec.begin(), 0);
+    EXPECT_EQ(it, vec.begin());
+    it = vec.insert(vec.end(), 5);
+    EXPECT_EQ(it, vec.end() - 1);
+    it = vec.insert(vec.begin() + 4, 4);
+    EXPECT_EQ(*it, 4);
+    expect_elements(vec, std::vector{0, 1, 2, 3, 4, 5});
+  }
+
+  {
+    StaticVector<std::string, 16UZ> vec{"b"s, "d"s};
+    const auto s = "a"s;
+    vec.insert(vec.begin(), s);
+    vec.insert(vec.begin() + 2, "c"s);
+    vec.insert(vec.end(), "e"s);
+    expect_elements(vec, std::vector{"a"s, "b"s, "c"s, "d"s, "e"s});
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, InsertAliasing) {
+  {
+    StaticVector<int, 16UZ> vec{1, 2, 3};
+    vec.insert(vec.begin(), vec.back());
+    vec.insert(vec.begin(), 2UZ, vec[1]);
+    expect_elements(vec, std::vector{1, 1, 3, 1, 2, 3});
+  }
+
+  {
+    StaticVector<std::string, 16UZ> vec{"x"s, "y"s, "z"s};
+    vec.emplace(vec.begin(), vec.back());
+    vec.insert(vec.begin() + 1, 3UZ, vec[2]);
+    expect_elements(vec, std::vector{"z"s, "y"s, "y"s, "y"s, "x"s, "y"s, "z"s});
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, InsertCount) {
+  StaticVector<std::string, 16UZ> vec{"a"s, "b"s, "c"s};
+  vec.insert(vec.begin() + 1, 3UZ, "-"s);
+  expect_elements(vec, std::vector{"a"s, "-"s, "-"s, "-"s, "b"s, "c"s});
+
+  // More new elements than elements behind the insert position and vice versa.
+  vec.insert(vec.end() - 1, 4UZ, "+"s);
+  expect_elements(vec, std::vector{"a"s, "-"s, "-"s, "-"s, "b"s, "+"s, "+"s, "+"s, "+"s, "c"s});
+
+  const auto it = vec.insert(vec.begin(), 0UZ, "!"s);
+  EXPECT_EQ(it, vec.begin());
+  EXPECT_EQ(vec.size(), 10UZ);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, InsertRange) {
+  {
+    StaticVector<int, 16UZ> vec{1, 5};
+    const std::vector<int> values{2, 3, 4};
+    const auto it = vec.insert(vec.begin() + 1, values.begin(), values.end());
+    EXPECT_EQ(it, vec.begin() + 1);
+    vec.insert(vec.end(), {6, 7});
+    vec.insert(vec.begin(), {-1, 0});
+    expect_elements(vec, std::vector{-1, 0, 1, 2, 3, 4, 5, 6, 7});
+  }
+
+  {
+    StaticVector<std::string, 16UZ> vec{"a"s, "e"s};
+    std::istringstream stream("b c d");
+    vec.insert(vec.begin() + 1,
+               std::istream_iterator<std::string>{stream},
+               std::istream_iterator<std::string>{});
+    expect_elements(vec, std::vector{"a"s, "b"s, "c"s, "d"s, "e"s});
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, Emplace) {
+  StaticVector<std::string, 16UZ> vec{"a"s, "b"s};
+  vec.emplace(vec.begin() + 1, 3UZ, '#');
+  vec.emplace(vec.end(), "c");
+  expect_elements(vec, std::vector{"a"s, "###"s, "b"s, "c"s});
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, Erase) {
+  {
+    StaticVector<int, 16UZ> vec{0, 1, 2, 3, 4, 5, 6};
+    auto it = vec.erase(vec.begin());
+    EXPECT_EQ(*it, 1);
+    it = vec.erase(vec.end() - 1);
+    EXPECT_EQ(it, vec.end());
+    it = vec.erase(vec.begin() + 1, vec.begin() + 3);
+    EXPECT_EQ(*it, 4);
+    it = vec.erase(vec.begin(), vec.begin());
+    EXPECT_EQ(it, vec.begin());
+    expect_elements(vec, std::vector{1, 4, 5});
+  }
+
+  {
+    StaticVector<std::string, 16UZ> vec{"a"s, "b"s, "c"s, "d"s, "e"s};
+    vec.erase(vec.begin() + 1);
+    vec.erase(vec.begin() + 1, vec.end() - 1);
+    expect_elements(vec, std::vector{"a"s, "e"s});
+    vec.erase(vec.begin(), vec.end());
+    EXPECT_TRUE(vec.empty());
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, DestructionCount) {
+  const auto p = std::make_shared<int>(0);
+  {
+    StaticVector<std::shared_ptr<int>, 16UZ> vec(4UZ, p);
+    EXPECT_EQ(p.use_count(), 5);
+
+    vec.insert(vec.begin() + 1, 3UZ, p);
+    EXPECT_EQ(p.use_count(), 8);
+    vec.emplace(vec.begin(), p);
+    EXPECT_EQ(p.use_count(), 9);
+    vec.erase(vec.begin() + 2, vec.begin() + 6);
+    EXPECT_EQ(p.use_count(), 5);
+    vec.erase(vec.begin());
+    EXPECT_EQ(p.use_count(), 4);
+  }
+  EXPECT_EQ(p.use_count(), 1);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, TriviallyRelocatable) {
+  static_assert(detail::is_trivially_relocatable_v<int>);
+  static_assert(!detail::is_trivially_relocatable_v<std::string>);
+  static_assert(detail::is_trivially_relocatable_v<Boxed>);
+
+  StaticVector<Boxed, 16UZ> vec;
+  vec.emplace_back(1);
+  vec.emplace_back(4);
+  vec.emplace(vec.begin() + 1, 2);
+  vec.emplace(vec.begin() + 2, 3);
+  vec.emplace(vec.begin(), 0);
+  ASSERT_EQ(vec.size(), 5UZ);
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(vec[i].value(), static_cast<int>(i));
+  }
+
+  vec.erase(vec.begin() + 1, vec.begin() + 3);
+  ASSERT_EQ(vec.size(), 3UZ);
+  EXPECT_EQ(vec[0].value(), 0);
+  EXPECT_EQ(vec[1].value(), 3);
+  EXPECT_EQ(vec[2].value(), 4);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, ConstantEvaluation) {
+  constexpr auto result = [] {
+    StaticVector<int, 8UZ> vec{1, 4};
+    vec.insert(vec.begin() + 1, {2, 3});
+    vec.emplace(vec.begin(), 0);
+    vec.insert(vec.end(), 2UZ, 5);
+    vec.erase(vec.begin() + 5);
+    int sum = 0;
+    for (size_t i = 0; i < vec.size(); ++i) {
+      sum += vec[i] * static_cast<int>(i + 1);
+    }
+    return sum;
+  }();
+  static_assert(result == 0 * 1 + 1 * 2 + 2 * 3 + 3 * 4 + 4 * 5 + 5 * 6);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, FromRange) {
+  {
+    const std::vector<int> values{1, 2, 3, 4};
+    const StaticVector<int, 8UZ> vec(detail::from_range, values);
+    expect_elements(vec, values);
+  }
+
+  {
+    const StaticVector<long, 8UZ> vec(detail::from_range, std::views::iota(0, 5));
+    expect_elements(vec, std::vector{0L, 1L, 2L, 3L, 4L});
+  }
+
+  {
+    std::istringstream stream("a b c");
+    const StaticVector<std::string, 8UZ> vec(
+        detail::from_range,
+        std::ranges::subrange(std::istream_iterator<std::string>{stream},
+                              std::istream_iterator<std::string>{}));
+    expect_elements(vec, std::vector{"a"s, "b"s, "c"s});
+  }
+
+  constexpr auto sum = [] {
+    const StaticVector<int, 8UZ> vec(detail::from_range, std::views::iota(1, 9));
+    int res = 0;
+    for (const auto& e : vec) {
+      res += e;
+    }
+    return res;
+  }();
+  static_assert(sum == 36);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, AppendRange) {
+  {
+    StaticVector<int, 16UZ> vec{1, 2};
+    vec.append_range(std::vector{3, 4, 5});
+    vec.append_range(std::views::iota(6, 8));
+    vec.append_range(std::vector<int>{});
+    const int raw[] = {8, 9};  // NOLINT
+    vec.append(raw, 2UZ);
+    expect_elements(vec, std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9});
+  }
+
+  {
+    StaticVector<std::string, 16UZ> vec{"a"s};
+    const std::array<std::string, 2> values{"b"s, "c"s};
+    vec.append_range(values);
+    vec.append_range(std::views::transform(values, [](const auto& s) { return s + s; }));
+    expect_elements(vec, std::vector{"a"s, "b"s, "c"s, "bb"s, "cc"s});
+  }
+
+  {
+    const auto p = std::make_shared<int>(0);
+    {
+      StaticVector<std::shared_ptr<int>, 8UZ> vec;
+      vec.append_range(std::vector{p, p, p});
+      EXPECT_EQ(p.use_count(), 4);
+    }
+    EXPECT_EQ(p.use_count(), 1);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, InsertRangeForm) {
+  {
+    StaticVector<int, 16UZ> vec{1, 6};
+    auto it = vec.insert_range(vec.begin() + 1, std::vector{2, 3});
+    EXPECT_EQ(it, vec.begin() + 1);
+    it = vec.insert_range(vec.begin() + 3, std::views::iota(4, 6));
+    EXPECT_EQ(*it, 4);
+    vec.insert_range(vec.end(), std::vector{7});
+    vec.insert_range(vec.begin(), std::vector<int>{});
+    expect_elements(vec, std::vector{1, 2, 3, 4, 5, 6, 7});
+  }
+
+  {
+    StaticVector<std::string, 16UZ> vec{"a"s, "d"s};
+    vec.insert_range(vec.begin() + 1, std::array{"b"s, "c"s});
+    std::istringstream stream("x y");
+    vec.insert_range(
+        vec.begin(),
+        std::ranges::subrange(std::istream_iterator<std::string>{stream},
+                              std::istream_iterator<std::string>{}));
+    expect_elements(vec, std::vector{"x"s, "y"s, "a"s, "b"s, "c"s, "d"s});
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, Resize) {
+  {
+    StaticVector<int, 16UZ> vec{1, 2, 3, 4, 5, 6};
+    vec.resize(2UZ);
+    expect_elements(vec, std::vector{1, 2});
+    vec.resize(5UZ);
+    expect_elements(vec, std::vector{1, 2, 0, 0, 0});
+    vec.resize(7UZ, -1);
+    expect_elements(vec, std::vector{1, 2, 0, 0, 0, -1, -1});
+    vec.resize(9UZ, 0x01010101);
+    expect_elements(vec, std::vector{1, 2, 0, 0, 0, -1, -1, 0x01010101, 0x01010101});
+    vec.resize(0UZ);
+    EXPECT_TRUE(vec.empty());
+  }
+
+  {
+    StaticVector<double*, 4UZ> vec;
+    vec.resize(4UZ);
+    for (const auto* p : vec) {
+      EXPECT_EQ(p, nullptr);
+    }
+  }
+
+  {
+    StaticVector<std::string, 16UZ> vec{"a"s, "b"s, "c"s};
+    vec.resize(5UZ);
+    expect_elements(vec, std::vector{"a"s, "b"s, "c"s, ""s, ""s});
+    vec.resize(6UZ, "x"s);
+    expect_elements(vec, std::vector{"a"s, "b"s, "c"s, ""s, ""s, "x"s});
+    vec.resize(1UZ);
+    expect_elements(vec, std::vector{"a"s});
+  }
+
+  {
+    const auto p = std::make_shared<int>(0);
+    {
+      StaticVector<std::shared_ptr<int>, 16UZ> vec;
+      vec.resize(10UZ, p);
+      EXPECT_EQ(p.use_count(), 11);
+      vec.resize(3UZ);
+      EXPECT_EQ(p.use_count(), 4);
+      vec.resize(5UZ);
+      EXPECT_EQ(p.use_count(), 4);
+      EXPECT_EQ(vec.back(), nullptr);
+    }
+    EXPECT_EQ(p.use_count(), 1);
+  }
+
+  constexpr auto sum = [] {
+    StaticVector<int, 8UZ> vec{1, 2, 3};
+    vec.resize(5UZ);
+    vec.resize(8UZ, 4);
+    vec.resize(7UZ);
+    int res = 0;
+    for (const auto& e : vec) {
+      res += e;
+    }
+    return res;
+  }();
+  static_assert(sum == 1 + 2 + 3 + 4 + 4);
+}
+
+// A trivially copyable type without default constructor, filling it must only copy-construct.
+struct NoDefault {
+  explicit NoDefault(int i)
+      : x(i) {}
+  int x;
+};
+
+TEST(Modify, FillWithoutDefaultConstructor) {
+  const auto expect_all = [](const auto& vec, size_t size, int x) {
+    ASSERT_EQ(vec.size(), size);
+    for (const auto& e : vec) {
+      EXPECT_EQ(e.x, x);
+    }
+  };
+
+  StaticVector<NoDefault, 40UZ> vec(37UZ, NoDefault{1});
+  expect_all(vec, 37UZ, 1);
+
+  vec.resize(3UZ, NoDefault{2});
+  expect_all(vec, 3UZ, 1);
+  vec.resize(40UZ, NoDefault{1});
+  expect_all(vec, 40UZ, 1);
+
+  vec.resize(0UZ, NoDefault{0});
+  vec.insert(vec.begin(), 20UZ, NoDefault{0x0102});
+  expect_all(vec, 20UZ, 0x0102);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, ResizeForOverwrite) {
+  {
+    const std::array<std::uint8_t, 6> message{'h', 'e', 'l', 'l', 'o', '!'};
+
+    StaticVector<std::uint8_t, 64UZ> buffer{'>'};
+    buffer.resize_for_overwrite(1UZ + message.size());
+    std::memcpy(buffer.data() + 1, message.data(), message.size());
+    expect_elements(buffer, std::vector<std::uint8_t>{'>', 'h', 'e', 'l', 'l', 'o', '!'});
+
+    buffer.resize_for_overwrite(2UZ);
+    expect_elements(buffer, std::vector<std::uint8_t>{'>', 'h'});
+  }
+
+  {
+    StaticVector<std::string, 8UZ> vec{"a"s};
+    vec.resize_for_overwrite(3UZ);
+    expect_elements(vec, std::vector{"a"s, ""s, ""s});
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, TryPushBack) {
+  StaticVector<std::string, 2UZ> vec;
+  auto* first = vec.try_push_back("a"s);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first, vec.data());
+
+  const auto b = "b"s;
+  EXPECT_EQ(vec.try_push_back(b), vec.data() + 1);
+
+  // A full vector leaves the argument untouched.
+  auto c = "A string that does not fit into the small string buffer"s;
+  EXPECT_EQ(vec.try_push_back(std::move(c)), nullptr);
+  EXPECT_EQ(c, "A string that does not fit into the small string buffer"s);  // NOLINT
+  EXPECT_EQ(vec.try_emplace_back(3UZ, 'c'), nullptr);
+  expect_elements(vec, std::vector{"a"s, "b"s});
+
+  StaticVector<int, 0UZ> empty;
+  EXPECT_EQ(empty.try_push_back(1), nullptr);
+  EXPECT_EQ(empty.try_emplace_back(), nullptr);
+}
+
+TEST(Modify, UncheckedPushBack) {
+  StaticVector<std::string, 4UZ> vec;
+  auto& a = vec.unchecked_push_back("a"s);
+  EXPECT_EQ(&a, vec.data());
+  const auto b = "b"s;
+  vec.unchecked_push_back(b);
+  EXPECT_EQ(vec.unchecked_emplace_back(3UZ, 'c'), "ccc"s);
+  expect_elements(vec, std::vector{"a"s, "b"s, "ccc"s});
+
+  constexpr auto sum = [] {
+    StaticVector<int, 4UZ> ints;
+    ints.unchecked_push_back(1);
+    ints.unchecked_emplace_back(2);
+    return *ints.try_push_back(3) + ints[0] + ints[1];
+  }();
+  static_assert(sum == 6);
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(Modify, Swap) {
+  // Trivially copyable elements, more than one block of bytes.
+  {
+    StaticVector<std::uint64_t, 64UZ> a(40UZ, 1U);
+    StaticVector<std::uint64_t, 64UZ> b(3UZ, 2U);
+    a.swap(b);
+    expect_elements(a, std::vector<std::uint64_t>(3UZ, 2U));
+    expect_elements(b, std::vector<std::uint64_t>(40UZ, 1U));
+    swap(a, b);
+    expect_elements(a, std::vector<std::uint64_t>(40UZ, 1U));
+    expect_elements(b, std::vector<std::uint64_t>(3UZ, 2U));
+  }
+
+  // Elements that are swapped and moved one by one, longer vector on either side.
+  {
+    StaticVector<std::string, 8UZ> a{"a"s,
+                                     "a string that does not fit into the small string buffer"s};
+    StaticVector<std::string, 8UZ> b{"x"s, "y"s, "z"s, "w"s};
+    using std::swap;
+    swap(a, b);
+    expect_elements(a, std::vector{"x"s, "y"s, "z"s, "w"s});
+    expect_elements(b,
+                    std::vector{"a"s, "a string that does not fit into the small string buffer"s});
+    b.swap(a);
+    expect_elements(a,
+                    std::vector{"a"s, "a string that does not fit into the small string buffer"s});
+    expect_elements(b, std::vector{"x"s, "y"s, "z"s, "w"s});
+    a.swap(a);
+    EXPECT_EQ(a.size(), 2UZ);
+  }
+
+  // Trivially relocatable elements are swapped as bytes, without leaking or freeing twice.
+  {
+    StaticVector<Boxed, 8UZ> a;
+    StaticVector<Boxed, 8UZ> b;
+    a.emplace_back(1);
+    for (int i = 0; i < 5; ++i) {
+      b.emplace_back(10 + i);
+    }
+    swap(a, b);
+    ASSERT_EQ(a.size(), 5UZ);
+    ASSERT_EQ(b.size(), 1UZ);
+    EXPECT_EQ(a[4].value(), 14);
+    EXPECT_EQ(b[0].value(), 1);
+  }
+
+  // No element is destroyed more or less often than it was constructed.
+  const auto p = std::make_shared<int>(0);
+  {
+    StaticVector<std::shared_ptr<int>, 8UZ> a(2UZ, p);
+    StaticVector<std::shared_ptr<int>, 8UZ> b(5UZ, p);
+    swap(a, b);
+    EXPECT_EQ(p.use_count(), 8);
+    EXPECT_EQ(a.size(), 5UZ);
+  }
+  EXPECT_EQ(p.use_count(), 1);
+
+  constexpr auto sizes = [] {
+    StaticVector<int, 4UZ> a{1, 2, 3};
+    StaticVector<int, 4UZ> b{4};
+    swap(a, b);
+    return (a.size() * 10UZ) + b.size() + static_cast<size_t>(b[2] * 100);
+  }();
+  static_assert(sizes == 13UZ + 300UZ);
+}
+
+TEST(Modify, UnorderedErase) {
+  StaticVector<std::string, 8UZ> vec{"a"s, "b"s, "c"s, "d"s};
+  auto it = vec.unordered_erase(vec.begin() + 1);
+  EXPECT_EQ(*it, "d"s);
+  expect_elements(vec, std::vector{"a"s, "d"s, "c"s});
+
+  // Erasing the last element moves nothing.
+  it = vec.unordered_erase(vec.end() - 1);
+  EXPECT_EQ(it, vec.end());
+  expect_elements(vec, std::vector{"a"s, "d"s});
+
+  EXPECT_EQ(vec.swap_remove(0UZ), "a"s);
+  expect_elements(vec, std::vector{"d"s});
+  EXPECT_EQ(vec.swap_remove(0UZ), "d"s);
+  EXPECT_TRUE(vec.empty());
+
+  const auto p = std::make_shared<int>(0);
+  {
+    StaticVector<std::shared_ptr<int>, 8UZ> ptrs(4UZ, p);
+    ptrs.unordered_erase(ptrs.begin());
+    EXPECT_EQ(p.use_count(), 4);
+    const auto removed = ptrs.swap_remove(1UZ);
+    EXPECT_EQ(p.use_count(), 4);
+    EXPECT_EQ(ptrs.size(), 2UZ);
+  }
+  EXPECT_EQ(p.use_count(), 1);
+
+  constexpr auto sum = [] {
+    StaticVector<int, 4UZ> ints{1, 2, 3, 4};
+    const auto removed = ints.swap_remove(0UZ);
+    return (removed * 100) + (ints[0] * 10) + static_cast<int>(ints.size());
+  }();
+  static_assert(sum == 143);
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include "PackedStaticVector.hpp"
+
+static_assert(std::random_access_iterator<PackedStaticVector<4UZ, 32UZ>::iterator>);
+static_assert(std::random_access_iterator<PackedStaticVector<4UZ, 32UZ>::const_iterator>);
+static_assert(std::random_access_iterator<PackedStaticVector<4UZ, 32UZ>::reverse_iterator>);
+static_assert(std::ranges::random_access_range<PackedBoolVector<100UZ>>);
+static_assert(std::ranges::random_access_range<const PackedBoolVector<100UZ>>);
+static_assert(std::is_same_v<PackedBoolVector<8UZ>::value_type, bool>);
+static_assert(std::is_same_v<PackedStaticVector<12UZ, 8UZ>::value_type, std::uint16_t>);
+static_assert(sizeof(PackedBoolVector<1024UZ>) == 136UZ);
+static_assert(PackedStaticVector<3UZ, 8UZ>::elements_per_word == 21UZ);
+
+// The vector is usable during constant evaluation.
+static_assert([] {
+  PackedStaticVector<5UZ, 40UZ> vec(20UZ, 3U);
+  vec[7] = 17U;
+  vec.push_back(31U);
+  return vec.count(3U) == 19UZ && vec.find_first(17U) == 7UZ && vec.pop_back() == 31U;
+}());
+
+// Random vector with values below `bound`, against a plain vector of the same values.
+template <size_t BITS, size_t CAPACITY>
+[[nodiscard]] auto make_random(size_t size, unsigned bound, std::uint32_t seed) {
+  using Vec = PackedStaticVector<BITS, CAPACITY>;
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<unsigned> dist(0U, bound - 1U);
+  Vec vec;
+  std::vector<typename Vec::value_type> expected;
+  for (size_t i = 0; i < size; ++i) {
+    const auto value = static_cast<typename Vec::value_type>(dist(rng));
+    vec.push_back(value);
+    expected.push_back(value);
+  }
+  return std::pair{vec, expected};
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(PackedVector, PushPopAccess) {
+  PackedStaticVector<4UZ, 40UZ> vec;
+  EXPECT_TRUE(vec.empty());
+  for (unsigned i = 0; i < 40U; ++i) {
+    vec.push_back(static_cast<std::uint8_t>(i % 16U));
+  }
+  EXPECT_TRUE(vec.full());
+  // Elements 16 to 31 fill the second word.
+  EXPECT_EQ(vec.words().size(), 3UZ);
+  EXPECT_EQ(vec.words()[1], 0xFEDC'BA98'7654'3210U);
+
+  vec[3] = 15U;
+  vec[4] = vec[3];
+  EXPECT_EQ(vec[3], 15U);
+  EXPECT_EQ(vec[4], 15U);
+  EXPECT_EQ(vec[5], 5U);
+  EXPECT_EQ(vec.front(), 0U);
+  EXPECT_EQ(vec.back(), 7U);
+
+  EXPECT_EQ(vec.pop_back(), 7U);
+  EXPECT_EQ(vec.size(), 39UZ);
+  // Popped fields are cleared, so equal vectors compare equal.
+  vec.push_back(0U);
+  vec.pop_back();
+  auto copy = vec;
+  EXPECT_EQ(copy, vec);
+  copy.back() = 1U;
+  EXPECT_NE(copy, vec);
+
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec, (PackedStaticVector<4UZ, 40UZ>{}));
+}
+
+TEST(PackedVector, FieldsDoNotStraddleWords) {
+  auto [vec, expected] = make_random<3UZ, 100UZ>(100UZ, 8U, 1U);
+  EXPECT_TRUE(std::ranges::equal(vec, expected));
+  for (size_t i = 0; i < vec.size(); ++i) {
+    vec[i] = static_cast<std::uint8_t>(7U - vec[i]);
+  }
+  EXPECT_TRUE(std::ranges::all_of(vec.words(), [](auto word) { return (word >> 63U) == 0U; }));
+  EXPECT_TRUE(std::ranges::equal(
+      vec, expected | std::views::transform([](auto v) { return static_cast<unsigned>(7U - v); })));
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(PackedVector, CountAndFindFirst) {
+  for (size_t size = 0; size <= 130UZ; size += 13UZ) {
+    auto [vec, expected] = make_random<5UZ, 130UZ>(size, 4U, static_cast<std::uint32_t>(size));
+    for (std::uint8_t value = 0U; value < 32U; ++value) {
+      EXPECT_EQ(vec.count(value), static_cast<size_t>(std::ranges::count(expected, value)))
+          << "size " << size << ", value " << +value;
+      const auto it = std::ranges::find(expected, value);
+      EXPECT_EQ(vec.find_first(value), static_cast<size_t>(it - expected.begin()))
+          << "size " << size << ", value " << +value;
+    }
+  }
+
+  // Zeros behind the last element are not counted.
+  PackedBoolVector<100UZ> bits(70UZ, true);
+  EXPECT_EQ(bits.count(false), 0UZ);
+  EXPECT_EQ(bits.find_first(false), 70UZ);
+  bits[69] = false;
+  EXPECT_EQ(bits.find_first(false), 69UZ);
+  EXPECT_EQ(bits.count(true), 69UZ);
+}
+
+TEST(PackedVector, ResizeAndFill) {
+  PackedStaticVector<7UZ, 50UZ> vec(5UZ, 100U);
+  vec.resize(30UZ, 42U);
+  EXPECT_EQ(vec.count(100U), 5UZ);
+  EXPECT_EQ(vec.count(42U), 25UZ);
+  vec.resize(12UZ);
+  EXPECT_EQ(vec.size(), 12UZ);
+  vec.resize(20UZ);
+  EXPECT_EQ(vec.count(0U), 8UZ);
+  EXPECT_EQ(vec[11], 42U);
+
+  vec.fill(127U);
+  EXPECT_EQ(vec.count(127U), 20UZ);
+  EXPECT_EQ(vec, (PackedStaticVector<7UZ, 50UZ>(20UZ, 127U)));
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(PackedVector, BitOperations) {
+  auto [a, a_bits] = make_random<1UZ, 200UZ>(150UZ, 2U, 1U);
+  auto [b, b_bits] = make_random<1UZ, 200UZ>(150UZ, 2U, 2U);
+
+  auto both = a;
+  both     &= b;
+  auto any  = a;
+  any      |= b;
+  auto diff = a;
+  diff     ^= b;
+  for (size_t i = 0; i < a.size(); ++i) {
+    EXPECT_EQ(both[i], a_bits[i] && b_bits[i]);
+    EXPECT_EQ(any[i], a_bits[i] || b_bits[i]);
+    EXPECT_EQ(diff[i], a_bits[i] != b_bits[i]);
+  }
+
+  auto flipped = a;
+  flipped.flip();
+  EXPECT_EQ(flipped.count(true), a.count(false));
+  flipped.flip();
+  EXPECT_EQ(flipped, a);
+}
+
+TEST(PackedVector, Iterators) {
+  auto [vec, expected] = make_random<6UZ, 64UZ>(50UZ, 64U, 3U);
+  EXPECT_TRUE(std::ranges::equal(vec.rbegin(), vec.rend(), expected.rbegin(), expected.rend()));
+  EXPECT_TRUE(std::ranges::equal(vec.crbegin(), vec.crend(), expected.rbegin(), expected.rend()));
+  EXPECT_EQ(vec.end() - vec.begin(), 50);
+  EXPECT_EQ(vec.cbegin()[10], expected[10]);
+  EXPECT_EQ(*(vec.cend() - 1), expected.back());
+
+  // Algorithms write through the proxies.
+  std::ranges::sort(vec);
+  std::ranges::sort(expected);
+  EXPECT_TRUE(std::ranges::equal(vec, expected));
+  std::ranges::reverse(vec);
+  EXPECT_TRUE(std::ranges::equal(vec, expected | std::views::reverse));
+  std::ranges::fill(vec.begin(), vec.begin() + 10, 9U);
+  EXPECT_EQ(vec.count(9U), 10UZ + static_cast<size_t>(std::ranges::count(
+                                      expected.begin(), expected.end() - 10, 9U)));
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "StaticSlotMap.hpp"
+
+using namespace std::string_literals;
+
+static_assert(std::ranges::contiguous_range<StaticSlotMap<std::string, 4UZ>>);
+static_assert(sizeof(StaticSlotMap<int, 4UZ>::Handle) == 8UZ);
+
+// The map is usable during constant evaluation, also with non-trivial elements.
+static_assert([] {
+  StaticSlotMap<std::string, 4UZ> map;
+  const auto a = map.insert("a");
+  const auto b = map.insert("b");
+  map.erase(a);
+  const auto c = map.insert("c");
+  return !map.contains(a) && map[b] == "b" && map[c] == "c" && c.index == a.index;
+}());
+
+// -------------------------------------------------------------------------------------------------
+TEST(SlotMap, InsertFindErase) {
+  StaticSlotMap<int, 4UZ> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(StaticSlotMap<int, 4UZ>::Handle{}));
+
+  const auto a = map.insert(1);
+  const auto b = map.emplace(2);
+  const auto c = map.insert(3);
+  EXPECT_EQ(map.size(), 3UZ);
+  EXPECT_EQ(map[a], 1);
+  EXPECT_EQ(map[b], 2);
+  ASSERT_NE(map.find(c), nullptr);
+  EXPECT_EQ(*map.find(c), 3);
+
+  EXPECT_TRUE(map.erase(a));
+  EXPECT_FALSE(map.erase(a));
+  EXPECT_FALSE(map.contains(a));
+  EXPECT_EQ(map.find(a), nullptr);
+
+  // The last element filled the gap, the other handles still find their elements.
+  EXPECT_EQ(map.size(), 2UZ);
+  EXPECT_EQ(map[b], 2);
+  EXPECT_EQ(map[c], 3);
+  EXPECT_EQ(std::vector<int>(map.begin(), map.end()), (std::vector<int>{3, 2}));
+}
+
+TEST(SlotMap, FreedSlotsAreReused) {
+  StaticSlotMap<int, 3UZ> map;
+  const auto a = map.insert(1);
+  const auto b = map.insert(2);
+  const auto c = map.insert(3);
+  EXPECT_TRUE(map.full());
+
+  map.erase(b);
+  map.erase(a);
+  // The most recently freed slot is reused first, with a new generation.
+  const auto d = map.insert(4);
+  const auto e = map.insert(5);
+  EXPECT_EQ(d.index, a.index);
+  EXPECT_EQ(e.index, b.index);
+  EXPECT_NE(d, a);
+  EXPECT_NE(e, b);
+  EXPECT_FALSE(map.contains(a));
+  EXPECT_FALSE(map.contains(b));
+  EXPECT_EQ(map[c], 3);
+  EXPECT_EQ(map[d], 4);
+  EXPECT_EQ(map[e], 5);
+  EXPECT_TRUE(map.full());
+
+  // Handles of slots that were never used or with forged generations are rejected.
+  EXPECT_FALSE(map.contains({.index = 7U, .generation = 1U}));
+  EXPECT_FALSE(map.contains({.index = d.index, .generation = d.generation + 1U}));
+  EXPECT_FALSE(map.contains({.index = d.index, .generation = d.generation + 2U}));
+}
+
+TEST(SlotMap, HandleAt) {
+  StaticSlotMap<int, 8UZ> map;
+  for (int i = 0; i < 8; ++i) {
+    map.insert(i);
+  }
+  map.erase(map.handle_at(2UZ));
+  map.erase(map.handle_at(5UZ));
+  for (size_t i = 0; i < map.size(); ++i) {
+    const auto handle = map.handle_at(i);
+    EXPECT_TRUE(map.contains(handle));
+    EXPECT_EQ(&map[handle], map.data() + i);
+  }
+}
+
+// -------------------------------------------------------------------------------------------------
+TEST(SlotMap, NonTrivialElements) {
+  const auto p = std::make_shared<int>(1);
+  {
+    StaticSlotMap<std::shared_ptr<int>, 4UZ> map;
+    const auto a = map.insert(p);
+    const auto b = map.insert(p);
+    map.insert(p);
+    EXPECT_EQ(p.use_count(), 4);
+
+    map.erase(a);
+    EXPECT_EQ(p.use_count(), 3);
+    EXPECT_EQ(map[b], p);
+
+    const auto copy = map;
+    EXPECT_EQ(p.use_count(), 5);
+    EXPECT_EQ(copy[b], p);
+  }
+  EXPECT_EQ(p.use_count(), 1);
+}
+
+TEST(SlotMap, CopyMoveClear) {
+  StaticSlotMap<std::string, 4UZ> map;
+  const auto a = map.insert("a string that does not fit into the small string buffer"s);
+  const auto b = map.insert("b"s);
+  map.erase(a);
+  const auto c = map.insert("c"s);
+
+  // Handles carry over to copies.
+  StaticSlotMap<std::string, 4UZ> copy;
+  copy = map;
+  EXPECT_EQ(copy[b], "b");
+  EXPECT_EQ(copy[c], "c");
+  EXPECT_FALSE(copy.contains(a));
+
+  const auto moved = std::move(copy);
+  EXPECT_EQ(moved[c], "c");
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(b));
+  EXPECT_FALSE(map.contains(c));
+  const auto d = map.insert("d"s);
+  EXPECT_EQ(map[d], "d");
+  EXPECT_EQ(map.size(), 1UZ);
+}
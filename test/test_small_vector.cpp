@@ -0,0 +1,347 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "SmallVector.hpp"
+
+using namespace std::string_literals;
+
+static_assert(std::contiguous_iterator<SmallVector<int, 4UZ>::iterator>);
+static_assert(std::ranges::contiguous_range<SmallVector<std::string, 4UZ>>);
+
+// The inline buffer comes first, followed by the pointer, size and capacity. The default allocator
+// takes no space.
+static_assert(sizeof(SmallVector<std::int32_t, 8UZ>) == (8UZ * sizeof(std::int32_t)) + 24UZ);
+
+template <typename Vec, typename Expected>
+void expect_elements(const Vec& vec, const Expected& expected) {
+  ASSERT_EQ(vec.size(), expected.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(vec[i], expected[i]) << "at index " << i;
+  }
+}
+
+// Counts the allocations and the live buffers of all copies of the allocator.
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  std::shared_ptr<int> allocations = std::make_shared<int>(0);
+  std::shared_ptr<int> live        = std::make_shared<int>(0);
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>& other) noexcept
+      : allocations(other.allocations),
+        live(other.live) {}
+
+  auto allocate(size_t n) -> T* {
+    ++*allocations;
+    ++*live;
+    return std::allocator<T>{}.allocate(n);
+  }
+  void deallocate(T* p, size_t n) noexcept {
+    --*live;
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  auto operator==(const CountingAllocator& other) const noexcept -> bool {
+    return allocations == other.allocations;
+  }
+};
+
+// -------------------------------------------------------------------------------------------------
+TEST(SmallVector, InlineAndSpill) {
+  SmallVector<int, 4UZ> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_TRUE(vec.is_inline());
+  EXPECT_EQ(vec.capacity(), 4UZ);
+
+  for (int i = 0; i < 4; ++i) {
+    vec.push_back(i);
+  }
+  EXPECT_TRUE(vec.is_inline());
+  EXPECT_EQ(vec.capacity(), 4UZ);
+
+  vec.push_back(4);
+  EXPECT_FALSE(vec.is_inline());
+  EXPECT_EQ(vec.capacity(), 8UZ);
+  for (int i = 5; i < 17; ++i) {
+    vec.emplace_back(i);
+  }
+  EXPECT_EQ(vec.capacity(), 32UZ);
+  EXPECT_EQ(vec.size(), 17UZ);
+  EXPECT_EQ(std::accumulate(vec.begin(), vec.end(), 0), 136);
+  EXPECT_EQ(vec.front(), 0);
+  EXPECT_EQ(vec.back(), 16);
+  EXPECT_EQ(*vec.rbegin(), 16);
+  EXPECT_EQ(std::distance(vec.rbegin(), vec.rend()), 17);
+
+  // Shrinking the size keeps the heap buffer, `shrink_to_fit` moves the elements back in place.
+  EXPECT_EQ(vec.pop_back(), 16);
+  vec.resize(3UZ);
+  EXPECT_FALSE(vec.is_inline());
+  vec.shrink_to_fit();
+  EXPECT_TRUE(vec.is_inline());
+  expect_elements(vec, std::vector{0, 1, 2});
+
+  vec.reserve(100UZ);
+  EXPECT_FALSE(vec.is_inline());
+  EXPECT_EQ(vec.capacity(), 100UZ);
+  vec.unchecked_push_back(3);
+  EXPECT_EQ(vec.unchecked_emplace_back(4), 4);
+  expect_elements(vec, std::vector{0, 1, 2, 3, 4});
+  vec.clear();
+  EXPECT_EQ(vec.capacity(), 100UZ);
+}
+
+TEST(SmallVector, PushBackAliasingElement) {
+  const auto long_string = "A string that does not fit into the small string buffer"s;
+  SmallVector<std::string, 2UZ> vec{long_string, "b"s};
+
+  // Growing relocates the elements, the argument must be copied before.
+  vec.push_back(vec[0]);
+  vec.push_back(vec.back());
+  expect_elements(vec, std::vector{long_string, "b"s, long_string, long_string});
+
+  vec.insert(vec.begin(), vec[1]);
+  EXPECT_EQ(vec[0], "b"s);
+  vec.resize(8UZ, vec[0]);
+  EXPECT_EQ(vec[7], "b"s);
+}
+
+TEST(SmallVector, CopyMove) {
+  const auto check_copy_and_move = [](const SmallVector<std::string, 4UZ>& vec) {
+    auto copy = vec;
+    expect_elements(copy, vec);
+    EXPECT_EQ(copy.is_inline(), vec.is_inline());
+
+    auto moved = std::move(copy);
+    expect_elements(moved, vec);
+    EXPECT_TRUE(copy.empty());      // NOLINT(bugprone-use-after-move)
+    EXPECT_TRUE(copy.is_inline());  // NOLINT(bugprone-use-after-move)
+
+    SmallVector<std::string, 4UZ> inline_target{"x"s};
+    inline_target = moved;
+    expect_elements(inline_target, vec);
+
+    SmallVector<std::string, 4UZ> heap_target(10UZ, "y"s);
+    heap_target = std::move(moved);
+    expect_elements(heap_target, vec);
+    EXPECT_TRUE(moved.empty());  // NOLINT(bugprone-use-after-move)
+
+    copy = std::move(heap_target);
+    expect_elements(copy, vec);
+  };
+
+  check_copy_and_move(SmallVector<std::string, 4UZ>{"a"s, "b"s});
+  SmallVector<std::string, 4UZ> heap;
+  for (int i = 0; i < 9; ++i) {
+    heap.push_back(std::to_string(i));
+  }
+  check_copy_and_move(heap);
+
+  // A moved heap buffer stays where it is.
+  const auto* data = heap.data();
+  auto moved       = std::move(heap);
+  EXPECT_EQ(moved.data(), data);
+}
+
+TEST(SmallVector, Destruction) {
+  auto counter = std::make_shared<int>(0);
+  {
+    SmallVector<std::shared_ptr<int>, 2UZ> vec;
+    vec.push_back(counter);
+    vec.push_back(counter);
+    EXPECT_EQ(counter.use_count(), 3);
+    vec.push_back(counter);
+    EXPECT_EQ(counter.use_count(), 4);
+
+    auto copy = vec;
+    EXPECT_EQ(counter.use_count(), 7);
+    copy.erase(copy.begin(), copy.begin() + 2);
+    EXPECT_EQ(counter.use_count(), 5);
+    copy = std::move(vec);
+    EXPECT_EQ(counter.use_count(), 4);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SmallVector, InsertErase) {
+  SmallVector<int, 4UZ> vec{1, 4};
+  vec.insert(vec.begin() + 1, {2, 3});
+  EXPECT_TRUE(vec.is_inline());
+  expect_elements(vec, std::vector{1, 2, 3, 4});
+
+  // Insertions across the inline capacity move the elements to the heap.
+  const auto it = vec.insert(vec.begin(), 3UZ, 0);
+  EXPECT_EQ(it, vec.begin());
+  EXPECT_FALSE(vec.is_inline());
+  expect_elements(vec, std::vector{0, 0, 0, 1, 2, 3, 4});
+
+  vec.insert_range(vec.end(), std::vector{5, 6});
+  vec.emplace(vec.begin() + 3, 9);
+  expect_elements(vec, std::vector{0, 0, 0, 9, 1, 2, 3, 4, 5, 6});
+
+  std::istringstream input("7 8");
+  vec.insert_range(vec.begin(), std::views::istream<int>(input));
+  expect_elements(vec, std::vector{7, 8, 0, 0, 0, 9, 1, 2, 3, 4, 5, 6});
+
+  vec.erase(vec.begin(), vec.begin() + 6);
+  vec.erase(vec.end() - 1);
+  expect_elements(vec, std::vector{1, 2, 3, 4, 5});
+
+  vec.append_range(std::views::iota(6, 9));
+  const int more[] = {9, 10};  // NOLINT
+  vec.append(more, 2UZ);
+  expect_elements(vec, std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+
+  const SmallVector<int, 2UZ> from_range(detail::from_range, vec | std::views::take(3));
+  expect_elements(from_range, std::vector{1, 2, 3});
+}
+
+TEST(SmallVector, Resize) {
+  SmallVector<int, 4UZ> vec;
+  vec.resize(3UZ);
+  EXPECT_TRUE(vec.is_inline());
+  expect_elements(vec, std::vector{0, 0, 0});
+  vec.resize(6UZ, 7);
+  expect_elements(vec, std::vector{0, 0, 0, 7, 7, 7});
+  vec.resize_for_overwrite(20UZ);
+  EXPECT_EQ(vec.size(), 20UZ);
+  EXPECT_GE(vec.capacity(), 20UZ);
+  vec.resize(1UZ);
+  expect_elements(vec, std::vector{0});
+}
+
+TEST(SmallVector, Allocator) {
+  CountingAllocator<int> allocator;
+  SmallVector<int, 4UZ, CountingAllocator<int>> vec(allocator);
+  for (int i = 0; i < 4; ++i) {
+    vec.push_back(i);
+  }
+  EXPECT_EQ(*allocator.allocations, 0);
+
+  // Growth is geometric: 8, 16, 32, 64.
+  for (int i = 4; i < 64; ++i) {
+    vec.push_back(i);
+  }
+  EXPECT_EQ(*allocator.allocations, 4);
+
+  // Moving takes over the buffer.
+  auto moved = std::move(vec);
+  EXPECT_EQ(*allocator.allocations, 4);
+  EXPECT_EQ(moved.size(), 64UZ);
+
+  // Move assignment between unequal allocators relocates the elements.
+  SmallVector<int, 4UZ, CountingAllocator<int>> other;
+  other = std::move(moved);
+  EXPECT_EQ(*other.get_allocator().allocations, 1);
+  EXPECT_EQ(other.size(), 64UZ);
+  EXPECT_TRUE(moved.empty());  // NOLINT(bugprone-use-after-move)
+}
+
+TEST(SmallVector, Swap) {
+  using Vec = SmallVector<std::string, 3UZ>;
+  const auto make = [](int first, int count) {
+    Vec res;
+    for (int i = first; i < first + count; ++i) {
+      res.push_back("a long string that does not fit into the SSO buffer "s + std::to_string(i));
+    }
+    return res;
+  };
+  const auto expected = [&](int first, int count) {
+    const auto vec = make(first, count);
+    return std::vector<std::string>(vec.begin(), vec.end());
+  };
+
+  // Both inline, with different sizes.
+  auto lhs = make(0, 1);
+  auto rhs = make(10, 3);
+  lhs.swap(rhs);
+  expect_elements(lhs, expected(10, 3));
+  expect_elements(rhs, expected(0, 1));
+  EXPECT_TRUE(lhs.is_inline());
+  EXPECT_TRUE(rhs.is_inline());
+
+  // Inline and heap, in both directions. The heap buffer changes hands.
+  auto heap        = make(20, 5);
+  const auto* data = heap.data();
+  swap(lhs, heap);
+  EXPECT_EQ(lhs.data(), data);
+  EXPECT_TRUE(heap.is_inline());
+  expect_elements(lhs, expected(20, 5));
+  expect_elements(heap, expected(10, 3));
+  swap(lhs, heap);
+  EXPECT_EQ(heap.data(), data);
+  EXPECT_TRUE(lhs.is_inline());
+  expect_elements(lhs, expected(10, 3));
+  expect_elements(heap, expected(20, 5));
+
+  // Both on the heap.
+  auto other                = make(30, 7);
+  const auto* other_data    = other.data();
+  const auto other_capacity = other.capacity();
+  const auto heap_capacity  = heap.capacity();
+  std::ranges::swap(heap, other);
+  EXPECT_EQ(heap.data(), other_data);
+  EXPECT_EQ(other.data(), data);
+  EXPECT_EQ(heap.capacity(), other_capacity);
+  EXPECT_EQ(other.capacity(), heap_capacity);
+  expect_elements(heap, expected(30, 7));
+  expect_elements(other, expected(20, 5));
+
+  // Empty and self swap.
+  Vec empty;
+  empty.swap(lhs);
+  EXPECT_TRUE(lhs.empty());
+  expect_elements(empty, expected(10, 3));
+  empty.swap(empty);
+  expect_elements(empty, expected(10, 3));
+}
+
+TEST(SmallVector, GrowThrowingConstructor) {
+  struct MayThrow {
+    int value;
+    explicit MayThrow(int v)
+        : value(v) {
+      if (v < 0) { throw std::runtime_error("negative"); }
+    }
+  };
+
+  CountingAllocator<MayThrow> allocator;
+  SmallVector<MayThrow, 2UZ, CountingAllocator<MayThrow>> vec(allocator);
+  vec.emplace_back(1);
+  vec.emplace_back(2);
+  EXPECT_THROW(vec.emplace_back(-1), std::runtime_error);
+
+  // The buffer allocated for the growth is released again, the elements are untouched.
+  EXPECT_EQ(*allocator.allocations, 1);
+  EXPECT_EQ(*allocator.live, 0);
+  EXPECT_TRUE(vec.is_inline());
+  ASSERT_EQ(vec.size(), 2UZ);
+  EXPECT_EQ(vec[0].value, 1);
+  EXPECT_EQ(vec[1].value, 2);
+}
+
+TEST(SmallVector, ConstantEvaluation) {
+  constexpr auto sum = [] {
+    SmallVector<int, 2UZ> vec;
+    for (int i = 1; i <= 10; ++i) {
+      vec.push_back(i);
+    }
+    vec.erase(vec.begin());
+    vec.shrink_to_fit();
+    return std::accumulate(vec.begin(), vec.end(), 0);
+  }();
+  static_assert(sum == 54);
+  EXPECT_EQ(sum, 54);
+}
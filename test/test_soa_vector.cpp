@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <tuple>
+
+#include "StaticSoAVector.hpp"
+
+using namespace std::string_literals;
+
+using Particle = std::tuple<double, float, std::int32_t>;
+
+static_assert(std::random_access_iterator<StaticSoAVector<Particle, 8UZ>::iterator>);
+static_assert(std::random_access_iterator<StaticSoAVector<Particle, 8UZ>::const_iterator>);
+static_assert(std::ranges::random_access_range<StaticSoAVector<Particle, 8UZ>>);
+static_assert(std::ranges::sized_range<StaticSoAVector<Particle, 8UZ>>);
+
+// The columns are stored back to back, the only padding is the alignment between them.
+static_assert(sizeof(StaticSoAVector<Particle, 8UZ>) ==
+              (8UZ * sizeof(double)) + (8UZ * sizeof(float)) + (8UZ * sizeof(std::int32_t)) + 8UZ);
+
+// -------------------------------------------------------------------------------------------------
+TEST(SoAVector, PushBackAndAccess) {
+  StaticSoAVector<Particle, 8UZ> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.capacity(), 8UZ);
+  EXPECT_EQ((StaticSoAVector<Particle, 8UZ>::field_count), 3UZ);
+
+  vec.push_back(Particle{1.0, 2.0F, 3});
+  const Particle p{4.0, 5.0F, 6};
+  vec.push_back(p);
+  vec.emplace_back(7.0, 8.0F, 9);
+  ASSERT_EQ(vec.size(), 3UZ);
+
+  EXPECT_EQ(std::get<0>(vec[0]), 1.0);
+  EXPECT_EQ(std::get<1>(vec[1]), 5.0F);
+  EXPECT_EQ(std::get<2>(vec[2]), 9);
+  EXPECT_EQ(vec.front(), (Particle{1.0, 2.0F, 3}));
+  EXPECT_EQ(vec.back(), (Particle{7.0, 8.0F, 9}));
+
+  // Rows are references into the columns.
+  std::get<2>(vec[1]) = 60;
+  EXPECT_EQ(vec.column<2>()[1], 60);
+
+  EXPECT_EQ(vec.pop_back(), (Particle{7.0, 8.0F, 9}));
+  EXPECT_EQ(vec.size(), 2UZ);
+
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+}
+
+TEST(SoAVector, Columns) {
+  StaticSoAVector<Particle, 16UZ> vec;
+  for (int i = 0; i < 10; ++i) {
+    vec.emplace_back(static_cast<double>(i), static_cast<float>(2 * i), 3 * i);
+  }
+
+  auto x = vec.column<0>();
+  static_assert(std::is_same_v<decltype(x), std::span<double>>);
+  ASSERT_EQ(x.size(), 10UZ);
+  EXPECT_EQ(std::accumulate(x.begin(), x.end(), 0.0), 45.0);
+
+  for (auto& y : vec.column<1>()) {
+    y += 1.0F;
+  }
+  EXPECT_EQ(std::get<1>(vec[4]), 9.0F);
+
+  const auto& cvec = vec;
+  static_assert(std::is_same_v<decltype(cvec.column<2>()), std::span<const std::int32_t>>);
+  EXPECT_EQ(cvec.column<2>().back(), 27);
+}
+
+TEST(SoAVector, Iterator) {
+  StaticSoAVector<std::tuple<int, char>, 8UZ> vec{{3, 'c'}, {1, 'a'}, {2, 'b'}};
+
+  std::string chars;
+  for (auto [i, c] : vec) {
+    chars.push_back(c);
+    i *= 10;
+  }
+  EXPECT_EQ(chars, "cab"s);
+  EXPECT_EQ(vec.column<0>()[2], 20);
+
+  auto it = vec.begin();
+  EXPECT_EQ(std::get<0>(*(it + 1)), 10);
+  EXPECT_EQ(std::get<1>(it[2]), 'b');
+  EXPECT_EQ(vec.end() - vec.begin(), 3);
+  EXPECT_EQ(std::distance(vec.cbegin(), vec.cend()), 3);
+  EXPECT_LT(it, vec.end());
+  EXPECT_EQ(--(++it), vec.begin());
+
+  const auto found =
+      std::ranges::find_if(vec, [](const auto& row) { return std::get<1>(row) == 'a'; });
+  EXPECT_EQ(found - vec.begin(), 1);
+
+  auto sum = 0;
+  for (const auto& row : std::as_const(vec) | std::views::reverse) {
+    sum = sum * 100 + std::get<0>(row);
+  }
+  EXPECT_EQ(sum, 201030);
+}
+
+TEST(SoAVector, CopyMoveAndDestruction) {
+  using Row = std::tuple<std::string, std::shared_ptr<int>>;
+  auto counter = std::make_shared<int>(0);
+
+  StaticSoAVector<Row, 4UZ> vec;
+  vec.emplace_back("A string that does not fit into the small string buffer"s, counter);
+  vec.emplace_back("b"s, counter);
+  EXPECT_EQ(counter.use_count(), 3);
+
+  {
+    auto copy = vec;
+    EXPECT_EQ(counter.use_count(), 5);
+    EXPECT_EQ(std::get<0>(copy[0]), std::get<0>(vec[0]));
+
+    auto moved = std::move(copy);
+    EXPECT_EQ(counter.use_count(), 5);
+    EXPECT_EQ(std::get<0>(moved[1]), "b"s);
+
+    copy = moved;
+    EXPECT_EQ(counter.use_count(), 7);
+    moved = std::move(copy);
+    EXPECT_EQ(counter.use_count(), 5);
+  }
+  EXPECT_EQ(counter.use_count(), 3);
+
+  vec.pop_back();
+  EXPECT_EQ(counter.use_count(), 2);
+  vec.clear();
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(SoAVector, ConstantEvaluation) {
+  constexpr auto sum = [] {
+    StaticSoAVector<std::tuple<int, float>, 4UZ> vec{{1, 2.0F}, {3, 4.0F}};
+    auto copy  = vec;
+    auto moved = std::move(copy);
+    copy       = moved;
+    moved      = std::move(copy);
+    vec.clear();
+    vec = moved;
+    return std::get<0>(vec[0]) + std::get<0>(moved[1]) + static_cast<int>(std::get<1>(vec[1]));
+  }();
+  static_assert(sum == 1 + 3 + 4);
+}